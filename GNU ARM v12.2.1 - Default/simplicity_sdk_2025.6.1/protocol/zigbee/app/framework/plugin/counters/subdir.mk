@@ -7,18 +7,21 @@ C_SRCS += \
 ../simplicity_sdk_2025.6.1/protocol/zigbee/app/framework/plugin/counters/af-counters.c \
 ../simplicity_sdk_2025.6.1/protocol/zigbee/app/framework/plugin/counters/counters-cb.c \
 ../simplicity_sdk_2025.6.1/protocol/zigbee/app/framework/plugin/counters/counters-cli.c \
+../simplicity_sdk_2025.6.1/protocol/zigbee/app/framework/plugin/counters/counters-metrics.c \
 ../simplicity_sdk_2025.6.1/protocol/zigbee/app/framework/plugin/counters/counters-ota.c 
 
 OBJS += \
 ./simplicity_sdk_2025.6.1/protocol/zigbee/app/framework/plugin/counters/af-counters.o \
 ./simplicity_sdk_2025.6.1/protocol/zigbee/app/framework/plugin/counters/counters-cb.o \
 ./simplicity_sdk_2025.6.1/protocol/zigbee/app/framework/plugin/counters/counters-cli.o \
+./simplicity_sdk_2025.6.1/protocol/zigbee/app/framework/plugin/counters/counters-metrics.o \
 ./simplicity_sdk_2025.6.1/protocol/zigbee/app/framework/plugin/counters/counters-ota.o 
 
 C_DEPS += \
 ./simplicity_sdk_2025.6.1/protocol/zigbee/app/framework/plugin/counters/af-counters.d \
 ./simplicity_sdk_2025.6.1/protocol/zigbee/app/framework/plugin/counters/counters-cb.d \
 ./simplicity_sdk_2025.6.1/protocol/zigbee/app/framework/plugin/counters/counters-cli.d \
+./simplicity_sdk_2025.6.1/protocol/zigbee/app/framework/plugin/counters/counters-metrics.d \
 ./simplicity_sdk_2025.6.1/protocol/zigbee/app/framework/plugin/counters/counters-ota.d 
 
 
@@ -44,6 +47,13 @@ simplicity_sdk_2025.6.1/protocol/zigbee/app/framework/plugin/counters/counters-c
 	@echo 'Finished building: $<'
 	@echo ' '
 
+simplicity_sdk_2025.6.1/protocol/zigbee/app/framework/plugin/counters/counters-metrics.o: ../simplicity_sdk_2025.6.1/protocol/zigbee/app/framework/plugin/counters/counters-metrics.c simplicity_sdk_2025.6.1/protocol/zigbee/app/framework/plugin/counters/subdir.mk
+	@echo 'Building file: $<'
+	@echo 'Invoking: GNU ARM C Compiler'
+	arm-none-eabi-gcc -g -gdwarf-2 -mcpu=cortex-m33 -mthumb -std=c18 '-DMGM210PA32JIA=1' '-DSL_CODE_COMPONENT_SYSTEM=system' '-DSL_APP_PROPERTIES=1' '-DSL_BOARD_NAME="BRD4308A"' '-DSL_BOARD_REV="A02"' '-DHARDWARE_BOARD_DEFAULT_RF_BAND_2400=1' '-DHARDWARE_BOARD_SUPPORTS_1_RF_BAND=1' '-DHARDWARE_BOARD_SUPPORTS_RF_BAND_2400=1' '-DSL_CODE_COMPONENT_BYTE_UTILITIES=byte_utilities' '-DSL_CODE_COMPONENT_CLOCK_MANAGER=clock_manager' '-DCUSTOM_TOKEN_HEADER="sl_token_manager_af_token_header.h"' '-DSL_TOKEN_MANAGER_BACKEND_INT_FLASH=1' '-DSL_TOKEN_MANAGER_BACKEND_INT_FLASH_SE=1' '-DSL_COMMON_TOKEN_MANAGER_ENABLE_DYNAMIC_TOKENS=1' '-DSL_COMMON_TOKEN_MANAGER_ENABLE_STATIC_TOKENS=1' '-DSL_COMPONENT_CATALOG_PRESENT=1' '-DSL_CODE_COMPONENT_DEVICE_PERIPHERAL=device_peripheral' '-DSL_CODE_COMPONENT_DMADRV=dmadrv' '-DSL_CODE_COMPONENT_GPIO=gpio' '-DSL_CODE_COMPONENT_HAL_COMMON=hal_common' '-DSL_CODE_COMPONENT_HAL_GPIO=hal_gpio' '-DSL_CODE_COMPONENT_INTERRUPT_MANAGER=interrupt_manager' '-DCMSIS_NVIC_VIRTUAL=1' '-DCMSIS_NVIC_VIRTUAL_HEADER_FILE="cmsis_nvic_virtual.h"' '-DSL_CODE_COMPONENT_LEGACY_HAL=legacy_hal' '-DCORTEXM3=1' '-DCORTEXM3_EFM32_MICRO=1' '-DCORTEXM3_EFR32=1' '-DPHY_RAIL=1' '-DPLATFORM_HEADER="platform-header.h"' '-DSL_LEGACY_HAL_ENABLE_WATCHDOG=1' '-DMBEDTLS_CONFIG_FILE=<sl_mbedtls_config.h>' '-DSL_CODE_COMPONENT_POWER_MANAGER=power_manager' '-DMBEDTLS_PSA_CRYPTO_CONFIG_FILE=<psa_crypto_config.h>' '-DSL_RAIL_LIB_MULTIPROTOCOL_SUPPORT=0' '-DSL_CODE_COMPONENT_RAIL_UTIL_IEEE802154_PHY_SELECT=rail_util_ieee802154_phy_select' '-DSL_CODE_COMPONENT_RAIL_UTIL_IEEE802154_STACK_EVENT=rail_util_ieee802154_stack_event' '-DSL_RAIL_UTIL_PA_CONFIG_HEADER=<sl_rail_util_pa_config.h>' '-DSL_CODE_COMPONENT_SE_MANAGER=se_manager' '-DSL_CODE_COMPONENT_CORE=core' '-DSL_RAIL_3_API=1' '-DSL_CODE_COMPONENT_SLEEPTIMER=sleeptimer' '-DSL_CODE_COMPONENT_PSEC_OSAL=psec_osal' '-DSL_ZIGBEE_LEAF_STACK=1' '-DSL_CODE_COMPONENT_BUFFER_MANAGER=buffer_manager' '-DSL_CODE_COMPONENT_IEEE_802_15_4_MAC=ieee_802_15_4_mac' '-DSL_CODE_COMPONENT_ZIGBEE_STACK=zigbee_stack' '-DSL_ZIGBEE_MULTI_NETWORK_STRIPPED=1' '-DSL_ZIGBEE_PHY_SELECT_STACK_SUPPORT=1' '-DSL_ZIGBEE_STACK_COMPLIANCE_REVISION=22' '-DSTACK_CORE_HEADER="stack/core/sl_zigbee_stack.h"' '-DSTACK_HEADER="stack/include/sl_zigbee.h"' '-DSTACK_TYPES_HEADER="stack/include/sl_zigbee_types.h"' '-DCONFIGURATION_HEADER="app/framework/util/config.h"' -I"/home/repo/SimplicityStudio/zigbee_end_device/autogen" -I"/home/repo/SimplicityStudio/zigbee_end_device/config" -I"/home/repo/SimplicityStudio/zigbee_end_device/config/prioconf" -I"/home/repo/SimplicityStudio/zigbee_end_device/config/zcl" -I"/home/repo/SimplicityStudio/zigbee_end_device/simplicity_sdk_2025.6.1/platform/Device/SiliconLabs/MGM21/Include" -I"/home/repo/SimplicityStudio/zigbee_end_device/simplicity_sdk_2025.6.1/platform/common/inc" -I"/home/repo/SimplicityStudio/zigbee_end_device/simplicity_sdk_2025.6.1/hardware/board/inc" -I"/home/repo/SimplicityStudio/zigbee_end_device/simplicity_sdk_2025.6.1/platform/bootloader" -I"/home/repo/SimplicityStudio/zigbee_end_device/simplicity_sdk_2025.6.1/platform/bootloader/api" -I"/home/repo/SimplicityStudio/zigbee_end_device/simplicity_sdk_2025.6.1/platform/bootloader/core/flash" -I"/home/repo/SimplicityStudio/zigbee_end_device/simplicity_sdk_2025.6.1/platform/driver/button/inc" -I"/home/repo/SimplicityStudio/zigbee_end_device/simplicity_sdk_2025.6.1/util/plugin/byte_utilities" -I"/home/repo/SimplicityStudio/zigbee_end_device/simplicity_sdk_2025.6.1/platform/service/cli/inc" -I"/home/repo/SimplicityStudio/zigbee_end_device/simplicity_sdk_2025.6.1/platform/service/cli/src" -I"/home/repo/SimplicityStudio/zigbee_end_device/simplicity_sdk_2025.6.1/platform/service/clock_manager/inc" -I"/home/repo/SimplicityStudio/zigbee_end_device/simplicity_sdk_2025.6.1/platform/service/clock_manager/src" -I"/home/repo/SimplicityStudio/zigbee_end_device/simplicity_sdk_2025.6.1/platform/CMSIS/Core/Include" -I"/home/repo/SimplicityStudio/zigbee_end_device/simplicity_sdk_2025.6.1/platform/service/token_manager/inc" -I"/home/repo/SimplicityStudio/zigbee_end_device/simplicity_sdk_2025.6.1/platform/service/token_manager/src" -I"/home/repo/SimplicityStudio/zigbee_end_device/simplicity_sdk_2025.6.1/platform/service/token_manager/legacy/inc" -I"/home/repo/SimplicityStudio/zigbee_end_device/simplicity_sdk_2025.6.1/hardware/driver/configuration_over_swo/inc" -I"/home/repo/SimplicityStudio/zigbee_end_device/simplicity_sdk_2025.6.1/platform/driver/debug/inc" -I"/home/repo/SimplicityStudio/zigbee_end_device/simplicity_sdk_2025.6.1/platform/service/device_manager/inc" -I"/home/repo/SimplicityStudio/zigbee_end_device/simplicity_sdk_2025.6.1/platform/emdrv/dmadrv/inc" -I"/home/repo/SimplicityStudio/zigbee_end_device/simplicity_sdk_2025.6.1/platform/emdrv/dmadrv/inc/s2_signals" -I"/home/repo/SimplicityStudio/zigbee_end_device/simplicity_sdk_2025.6.1/platform/emdrv/common/inc" -I"/home/repo/SimplicityStudio/zigbee_end_device/simplicity_sdk_2025.6.1/platform/emlib/inc" -I"/home/repo/SimplicityStudio/zigbee_end_device/simplicity_sdk_2025.6.1/platform/radio/rail_lib/plugin/fem_util" -I"/home/repo/SimplicityStudio/zigbee_end_device/simplicity_sdk_2025.6.1/platform/driver/gpio/inc" -I"/home/repo/SimplicityStudio/zigbee_end_device/simplicity_sdk_2025.6.1/platform/peripheral/inc" -I"/home/repo/SimplicityStudio/zigbee_end_device/simplicity_sdk_2025.6.1/platform/service/interrupt_manager/inc" -I"/home/repo/SimplicityStudio/zigbee_end_device/simplicity_sdk_2025.6.1/platform/service/interrupt_manager/src" -I"/home/repo/SimplicityStudio/zigbee_end_device/simplicity_sdk_2025.6.1/platform/service/interrupt_manager/inc/arm" -I"/home/repo/SimplicityStudio/zigbee_end_device/simplicity_sdk_2025.6.1/platform/service/iostream/inc" -I"/home/repo/SimplicityStudio/zigbee_end_device/simplicity_sdk_2025.6.1/platform/driver/leddrv/inc" -I"/home/repo/SimplicityStudio/zigbee_end_device/simplicity_sdk_2025.6.1/platform/service/legacy_hal/inc" -I"/home/repo/SimplicityStudio/zigbee_end_device/simplicity_sdk_2025.6.1/platform/service/legacy_hal_wdog/inc" -I"/home/repo/SimplicityStudio/zigbee_end_device/simplicity_sdk_2025.6.1/platform/security/sl_component/sl_mbedtls_support/config" -I"/home/repo/SimplicityStudio/zigbee_end_device/simplicity_sdk_2025.6.1/platform/security/sl_component/sl_mbedtls_support/inc" -I"/home/repo/SimplicityStudio/zigbee_end_device/simplicity_sdk_2025.6.1/util/third_party/mbedtls/include" -I"/home/repo/SimplicityStudio/zigbee_end_device/simplicity_sdk_2025.6.1/util/third_party/mbedtls/library" -I"/home/repo/SimplicityStudio/zigbee_end_device/simplicity_sdk_2025.6.1/platform/service/memory_manager/inc" -I"/home/repo/SimplicityStudio/zigbee_end_device/simplicity_sdk_2025.6.1/platform/service/memory_manager/src" -I"/home/repo/SimplicityStudio/zigbee_end_device/simplicity_sdk_2025.6.1/platform/emdrv/nvm3/inc" -I"/home/repo/SimplicityStudio/zigbee_end_device/simplicity_sdk_2025.6.1/platform/emdrv/nvm3/config" -I"/home/repo/SimplicityStudio/zigbee_end_device/simplicity_sdk_2025.6.1/platform/service/power_manager/inc" -I"/home/repo/SimplicityStudio/zigbee_end_device/simplicity_sdk_2025.6.1/util/third_party/printf" -I"/home/repo/SimplicityStudio/zigbee_end_device/simplicity_sdk_2025.6.1/util/third_party/printf/inc" -I"/home/repo/SimplicityStudio/zigbee_end_device/simplicity_sdk_2025.6.1/platform/security/sl_component/sl_psa_driver/inc" -I"/home/repo/SimplicityStudio/zigbee_end_device/simplicity_sdk_2025.6.1/platform/radio/rail_lib/common" -I"/home/repo/SimplicityStudio/zigbee_end_device/simplicity_sdk_2025.6.1/platform/radio/rail_lib/protocol/ble" -I"/home/repo/SimplicityStudio/zigbee_end_device/simplicity_sdk_2025.6.1/platform/radio/rail_lib/protocol/ieee802154" -I"/home/repo/SimplicityStudio/zigbee_end_device/simplicity_sdk_2025.6.1/platform/radio/rail_lib/protocol/wmbus" -I"/home/repo/SimplicityStudio/zigbee_end_device/simplicity_sdk_2025.6.1/platform/radio/rail_lib/protocol/zwave" -I"/home/repo/SimplicityStudio/zigbee_end_device/simplicity_sdk_2025.6.1/platform/radio/rail_lib/chip/efr32/efr32xg2x" -I"/home/repo/SimplicityStudio/zigbee_end_device/simplicity_sdk_2025.6.1/platform/radio/rail_lib/protocol/sidewalk" -I"/home/repo/SimplicityStudio/zigbee_end_device/simplicity_sdk_2025.6.1/platform/radio/rail_lib/plugin/rail_util_ieee802154" -I"/home/repo/SimplicityStudio/zigbee_end_device/simplicity_sdk_2025.6.1/platform/radio/rail_lib/plugin/pa-conversions" -I"/home/repo/SimplicityStudio/zigbee_end_device/simplicity_sdk_2025.6.1/platform/radio/rail_lib/plugin/pa-conversions/efr32xg21" -I"/home/repo/SimplicityStudio/zigbee_end_device/simplicity_sdk_2025.6.1/platform/radio/rail_lib/plugin/rail_util_power_manager_init" -I"/home/repo/SimplicityStudio/zigbee_end_device/simplicity_sdk_2025.6.1/platform/radio/rail_lib/plugin/rail_util_pti" -I"/home/repo/SimplicityStudio/zigbee_end_device/simplicity_sdk_2025.6.1/platform/radio/rail_lib/plugin/rail_util_rf_path" -I"/home/repo/SimplicityStudio/zigbee_end_device/simplicity_sdk_2025.6.1/platform/security/sl_component/se_manager/inc" -I"/home/repo/SimplicityStudio/zigbee_end_device/simplicity_sdk_2025.6.1/platform/service/sl_main/inc" -I"/home/repo/SimplicityStudio/zigbee_end_device/simplicity_sdk_2025.6.1/platform/service/sl_main/src" -I"/home/repo/SimplicityStudio/zigbee_end_device/simplicity_sdk_2025.6.1/platform/service/sleeptimer/inc" -I"/home/repo/SimplicityStudio/zigbee_end_device/simplicity_sdk_2025.6.1/platform/security/sl_component/sli_psec_osal/inc" -I"/home/repo/SimplicityStudio/zigbee_end_device/simplicity_sdk_2025.6.1/platform/service/udelay/inc" -I"/home/repo/SimplicityStudio/zigbee_end_device/simplicity_sdk_2025.6.1/protocol/zigbee/app/framework/plugin/basic" -I"/home/repo/SimplicityStudio/zigbee_end_device/simplicity_sdk_2025.6.1/protocol/zigbee/stack/platform/micro" -I"/home/repo/SimplicityStudio/zigbee_end_device/simplicity_sdk_2025.6.1/protocol/zigbee/app/util/serial" -I"/home/repo/SimplicityStudio/zigbee_end_device/simplicity_sdk_2025.6.1/protocol/zigbee/app/framework/service-function" -I"/home/repo/SimplicityStudio/zigbee_end_device/simplicity_sdk_2025.6.1/protocol/zigbee/app/framework/plugin/counters" -I"/home/repo/SimplicityStudio/zigbee_end_device/simplicity_sdk_2025.6.1/protocol/zigbee/stack/framework" -I"/home/repo/SimplicityStudio/zigbee_end_device/simplicity_sdk_2025.6.1/protocol/zigbee/app/framework/plugin/debug-print" -I"/home/repo/SimplicityStudio/zigbee_end_device/simplicity_sdk_2025.6.1/protocol/zigbee/app/framework/plugin/find-and-bind-initiator" -I"/home/repo/SimplicityStudio/zigbee_end_device/simplicity_sdk_2025.6.1/protocol/zigbee/app/framework/plugin/network-steering" -I"/home/repo/SimplicityStudio/zigbee_end_device/simplicity_sdk_2025.6.1/protocol/zigbee/app/framework/plugin/reporting" -I"/home/repo/SimplicityStudio/zigbee_end_device/simplicity_sdk_2025.6.1/protocol/zigbee/app/framework/plugin/scan-dispatch" -I"/home/repo/SimplicityStudio/zigbee_end_device/simplicity_sdk_2025.6.1/protocol/zigbee/stack/include" -I"/home/repo/SimplicityStudio/zigbee_end_device/simplicity_sdk_2025.6.1/protocol/zigbee/stack/security" -I"/home/repo/SimplicityStudio/zigbee_end_device/simplicity_sdk_2025.6.1/protocol/zigbee/stack/internal/inc" -I"/home/repo/SimplicityStudio/zigbee_end_device/simplicity_sdk_2025.6.1/protocol/zigbee/app/framework/signature-decode" -I"/home/repo/SimplicityStudio/zigbee_end_device/simplicity_sdk_2025.6.1/platform/radio/rail_lib/plugin" -I"/home/repo/SimplicityStudio/zigbee_end_device/simplicity_sdk_2025.6.1/protocol/zigbee" -I"/home/repo/SimplicityStudio/zigbee_end_device/simplicity_sdk_2025.6.1/protocol/zigbee/app/util/counters" -I"/home/repo/SimplicityStudio/zigbee_end_device/simplicity_sdk_2025.6.1/protocol/zigbee/stack" -I"/home/repo/SimplicityStudio/zigbee_end_device/simplicity_sdk_2025.6.1/protocol/zigbee/stack/zigbee" -I"/home/repo/SimplicityStudio/zigbee_end_device/simplicity_sdk_2025.6.1/platform/radio/mac/rail_mux" -I"/home/repo/SimplicityStudio/zigbee_end_device/simplicity_sdk_2025.6.1/platform/radio/mac" -I"/home/repo/SimplicityStudio/zigbee_end_device/simplicity_sdk_2025.6.1/util/silicon_labs/silabs_core" -I"/home/repo/SimplicityStudio/zigbee_end_device/simplicity_sdk_2025.6.1/protocol/zigbee/stack/core" -I"/home/repo/SimplicityStudio/zigbee_end_device/simplicity_sdk_2025.6.1/protocol/zigbee/stack/mac" -I"/home/repo/SimplicityStudio/zigbee_end_device/simplicity_sdk_2025.6.1/protocol/zigbee/stack/routing/zigbee" -I"/home/repo/SimplicityStudio/zigbee_end_device/simplicity_sdk_2025.6.1/protocol/zigbee/app/em260" -I"/home/repo/SimplicityStudio/zigbee_end_device/simplicity_sdk_2025.6.1/protocol/zigbee/stack/internal/src/ipc" -I"/home/repo/SimplicityStudio/zigbee_end_device/simplicity_sdk_2025.6.1/protocol/zigbee/app/framework/common" -I"/home/repo/SimplicityStudio/zigbee_end_device/simplicity_sdk_2025.6.1/protocol/zigbee/app/framework/plugin/update-tc-link-key" -I"/home/repo/SimplicityStudio/zigbee_end_device/simplicity_sdk_2025.6.1/protocol/zigbee/app/framework/include" -I"/home/repo/SimplicityStudio/zigbee_end_device/simplicity_sdk_2025.6.1/protocol/zigbee/app/framework/util" -I"/home/repo/SimplicityStudio/zigbee_end_device/simplicity_sdk_2025.6.1/protocol/zigbee/app/framework/security" -I"/home/repo/SimplicityStudio/zigbee_end_device/simplicity_sdk_2025.6.1/protocol/zigbee/app/util/zigbee-framework" -I"/home/repo/SimplicityStudio/zigbee_end_device/simplicity_sdk_2025.6.1/protocol/zigbee/app/framework/cli" -I"/home/repo/SimplicityStudio/zigbee_end_device/simplicity_sdk_2025.6.1/protocol/zigbee/app/util/common" -I"/home/repo/SimplicityStudio/zigbee_end_device/simplicity_sdk_2025.6.1/protocol/zigbee/app/util/security" -Os -Wall -Wextra -ffunction-sections -fdata-sections -mcmse -mfpu=fpv5-sp-d16 -mfloat-abi=hard -fno-builtin-printf -fno-builtin-sprintf -flto=auto -fwhole-program --specs=nano.specs -Wno-unused-parameter -Wno-missing-field-initializers -Wno-missing-braces -c -fmessage-length=0 -MMD -MP -MF"simplicity_sdk_2025.6.1/protocol/zigbee/app/framework/plugin/counters/counters-metrics.d" -MT"$@" -o "$@" "$<"
+	@echo 'Finished building: $<'
+	@echo ' '
+
 simplicity_sdk_2025.6.1/protocol/zigbee/app/framework/plugin/counters/counters-ota.o: ../simplicity_sdk_2025.6.1/protocol/zigbee/app/framework/plugin/counters/counters-ota.c simplicity_sdk_2025.6.1/protocol/zigbee/app/framework/plugin/counters/subdir.mk
 	@echo 'Building file: $<'
 	@echo 'Invoking: GNU ARM C Compiler'
@@ -67,12 +67,37 @@
 #define TEMPERATURE_UPDATE_DELAY_MS       2000
 #define LED_BLINK_PERIOD_MS               2000
 
+// Sampling interval grows up to this value while the temperature is stable
+// and drops back to TEMPERATURE_UPDATE_DELAY_MS as soon as it changes.
+#define TEMPERATURE_MAX_UPDATE_DELAY_MS  60000
+// Smallest change (value x 100) of the smoothed temperature that is written
+// to the attribute. Smaller changes do not trigger attribute callbacks,
+// reporting or NVM writes.
+#define TEMPERATURE_DEADBAND               50
+// Exponential smoothing factor, new = old + (sample - old) / 2^shift.
+// 0 disables smoothing.
+#define TEMPERATURE_SMOOTHING_SHIFT         1
+
 // -----------------------------------------------------------------------------
 //                          Global Variables
 // -----------------------------------------------------------------------------
 static bool commissioning = false;   // Holds the commissioning status
 static int16_t temperature = 2200;  // Example temperature, value x 100, -10 to 80
 
+// Sampling state of a measured value, see sensor_sample_update().
+typedef struct {
+  int32_t smoothed;          // Smoothed value, 4 fractional bits
+  int16_t pending;           // Value waiting to be written to the attribute
+  int16_t written;           // Last value written to the attribute
+  bool has_sample;           // Set once the first sample is taken
+  bool has_written;          // Set once a value is written to the attribute
+  uint32_t interval_ms;      // Delay until the next sample
+} sensor_sample_t;
+
+static sensor_sample_t temperature_sample = {
+  .interval_ms = TEMPERATURE_UPDATE_DELAY_MS,
+};
+
 // Custom event controls
 static sl_zigbee_af_event_t run_temperature_event_control;
 static sl_zigbee_af_event_t network_control_event_control;
@@ -86,6 +111,7 @@ static void run_temperature_event_handler(sl_zigbee_af_event_t *event);
 static void network_control_event_handler(sl_zigbee_af_event_t *event);
 static void attribute_report_event_handler(sl_zigbee_af_event_t *event);
 static void led_event_handler(sl_zigbee_af_event_t *event);
+static bool sensor_sample_update(sensor_sample_t *sample, int16_t value);
 
 // -----------------------------------------------------------------------------
 //                          Callback Handler
@@ -236,6 +262,47 @@ static void led_event_handler(sl_zigbee_af_event_t *event)
   }
 }
 
+/**
+ * Feed a new sample into the sampling state.
+ *
+ * The sample is smoothed and compared with the last written value. The
+ * sampling interval doubles, up to TEMPERATURE_MAX_UPDATE_DELAY_MS, every time
+ * the smoothed value stays inside the deadband, and goes back to
+ * TEMPERATURE_UPDATE_DELAY_MS when it leaves it.
+ *
+ * Returns true and sets sample->pending when the attribute should be written.
+ */
+static bool sensor_sample_update(sensor_sample_t *sample, int16_t value)
+{
+  int32_t smoothed;
+  int32_t delta;
+
+  if (!sample->has_sample) {
+    sample->smoothed = (int32_t)value * 16;
+    sample->has_sample = true;
+  } else {
+    sample->smoothed += ((int32_t)value * 16 - sample->smoothed)
+                        / (1 << TEMPERATURE_SMOOTHING_SHIFT);
+  }
+  smoothed = (sample->smoothed >= 0)
+             ? (sample->smoothed + 8) / 16
+             : (sample->smoothed - 8) / 16;
+
+  delta = smoothed - sample->written;
+  if (sample->has_written
+      && delta < TEMPERATURE_DEADBAND
+      && delta > -TEMPERATURE_DEADBAND) {
+    sample->interval_ms = (sample->interval_ms > TEMPERATURE_MAX_UPDATE_DELAY_MS / 2)
+                          ? TEMPERATURE_MAX_UPDATE_DELAY_MS
+                          : sample->interval_ms * 2;
+    return false;
+  }
+
+  sample->interval_ms = TEMPERATURE_UPDATE_DELAY_MS;
+  sample->pending = (int16_t)smoothed;
+  return true;
+}
+
 /**
  * This function is called whenever a temperature measurement is enabled
  */
@@ -248,9 +315,11 @@ static void run_temperature_event_handler(sl_zigbee_af_event_t *event)
     temperature = -1000;
   }
   sl_zigbee_app_debug_println("Running temperature measurement: %d\n", temperature);
-  sl_zigbee_af_event_set_active(&attribute_report_event_control);
+  if (sensor_sample_update(&temperature_sample, temperature)) {
+    sl_zigbee_af_event_set_active(&attribute_report_event_control);
+  }
   sl_zigbee_af_event_set_delay_ms(&run_temperature_event_control,
-                                  TEMPERATURE_UPDATE_DELAY_MS);
+                                  temperature_sample.interval_ms);
 }
 
 
@@ -274,13 +343,16 @@ static void attribute_report_event_handler(sl_zigbee_af_event_t *event)
   status = sl_zigbee_af_write_server_attribute(TEMPERATURE_MEASUREMENT_ENDPOINT,
                                                ZCL_TEMP_MEASUREMENT_CLUSTER_ID,
                                                ZCL_TEMP_MEASURED_VALUE_ATTRIBUTE_ID,
-                                               (uint8_t *)&temperature,
+                                               (uint8_t *)&temperature_sample.pending,
                                                ZCL_INT16S_ATTRIBUTE_TYPE);
 
   if (status != SL_ZIGBEE_ZCL_STATUS_SUCCESS) {
     sl_zigbee_app_debug_print("Failed to report temperature: 0x%X\n", status);
   } else {
-    sl_zigbee_app_debug_print("Temperature reported: %d\n", temperature);
+    temperature_sample.written = temperature_sample.pending;
+    temperature_sample.has_written = true;
+    sl_zigbee_app_debug_print("Temperature reported: %d\n",
+                              temperature_sample.written);
   }
 }
 
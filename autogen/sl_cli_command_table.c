@@ -140,6 +140,15 @@ void endpointPrint(sl_cli_command_arg_t *arguments);
 void enableDisableEndpoint(sl_cli_command_arg_t *arguments);
 void enableDisableEndpoint(sl_cli_command_arg_t *arguments);
 void printEvents(sl_cli_command_arg_t *arguments);
+void printEventProfile(sl_cli_command_arg_t *arguments);
+void resetEventProfile(sl_cli_command_arg_t *arguments);
+void printBootTrace(sl_cli_command_arg_t *arguments);
+void printProcessActionProfile(sl_cli_command_arg_t *arguments);
+void resetProcessActionProfile(sl_cli_command_arg_t *arguments);
+void printPowerStatistics(sl_cli_command_arg_t *arguments);
+void resetPowerStatistics(sl_cli_command_arg_t *arguments);
+void printSleepLog(sl_cli_command_arg_t *arguments);
+void resetSleepLog(sl_cli_command_arg_t *arguments);
 void getSetMfgToken(sl_cli_command_arg_t *arguments);
 void getSetMfgToken(sl_cli_command_arg_t *arguments);
 void sl_zigbee_af_counters_print_command(sl_cli_command_arg_t *arguments);
@@ -150,6 +159,9 @@ void sl_zigbee_af_counters_print_thresholds_command(sl_cli_command_arg_t *argume
 void sl_zigbee_af_counters_set_threshold_command(sl_cli_command_arg_t *arguments);
 void sl_zigbee_af_counters_reset_thresholds_command(sl_cli_command_arg_t *arguments);
 void sl_zigbee_af_counters_send_request_command(sl_cli_command_arg_t *arguments);
+void sl_zigbee_af_counters_metrics_print_command(sl_cli_command_arg_t *arguments);
+void sl_zigbee_af_counters_metrics_clear_command(sl_cli_command_arg_t *arguments);
+void sl_zigbee_af_counters_send_metrics_request_command(sl_cli_command_arg_t *arguments);
 void sli_zigbee_debug_print_enable_stack_type_command(sl_cli_command_arg_t *arguments);
 void sli_zigbee_debug_print_enable_core_type_command(sl_cli_command_arg_t *arguments);
 void sli_zigbee_debug_print_enable_app_type_command(sl_cli_command_arg_t *arguments);
@@ -169,6 +181,8 @@ void sli_zigbee_af_reporting_cli_remove(sl_cli_command_arg_t *arguments);
 void sli_zigbee_af_reporting_cli_add(sl_cli_command_arg_t *arguments);
 void sli_zigbee_af_reporting_cli_clear_last_report_time(sl_cli_command_arg_t *arguments);
 void sli_zigbee_af_reporting_cli_test_timing(sl_cli_command_arg_t *arguments);
+void sli_zigbee_af_reporting_cli_stats(sl_cli_command_arg_t *arguments);
+void sli_zigbee_af_reporting_cli_clear_stats(sl_cli_command_arg_t *arguments);
 void sl_zigbee_af_idle_sleep_status_command(sl_cli_command_arg_t *arguments);
 void sl_zigbee_af_idle_sleep_stay_awake_command(sl_cli_command_arg_t *arguments);
 void sl_zigbee_af_idle_sleep_awake_when_not_joined_command(sl_cli_command_arg_t *arguments);
@@ -353,6 +367,60 @@ static const sl_cli_command_info_t cli_cmd__events = \
                   "",
                  {SL_CLI_ARG_END, });
 
+static const sl_cli_command_info_t cli_cmd__boot_hyphen_trace = \
+  SL_CLI_COMMAND(printBootTrace,
+                 "Print the time spent in each initialization step.",
+                  "",
+                 {SL_CLI_ARG_END, });
+
+static const sl_cli_command_info_t cli_cmd_event_hyphen_profile_print = \
+  SL_CLI_COMMAND(printEventProfile,
+                 "Print event handler runtime and lateness statistics.",
+                  "",
+                 {SL_CLI_ARG_END, });
+
+static const sl_cli_command_info_t cli_cmd_event_hyphen_profile_reset = \
+  SL_CLI_COMMAND(resetEventProfile,
+                 "Clear event handler statistics.",
+                  "",
+                 {SL_CLI_ARG_END, });
+
+static const sl_cli_command_info_t cli_cmd_process_hyphen_action_hyphen_profile_print = \
+  SL_CLI_COMMAND(printProcessActionProfile,
+                 "Print main loop process action cycle statistics.",
+                  "",
+                 {SL_CLI_ARG_END, });
+
+static const sl_cli_command_info_t cli_cmd_process_hyphen_action_hyphen_profile_reset = \
+  SL_CLI_COMMAND(resetProcessActionProfile,
+                 "Clear process action statistics.",
+                  "",
+                 {SL_CLI_ARG_END, });
+
+static const sl_cli_command_info_t cli_cmd_power_hyphen_stats_print = \
+  SL_CLI_COMMAND(printPowerStatistics,
+                 "Print energy mode residency, wake-up sources and rejected sleeps.",
+                  "",
+                 {SL_CLI_ARG_END, });
+
+static const sl_cli_command_info_t cli_cmd_power_hyphen_stats_reset = \
+  SL_CLI_COMMAND(resetPowerStatistics,
+                 "Clear energy mode statistics.",
+                  "",
+                 {SL_CLI_ARG_END, });
+
+static const sl_cli_command_info_t cli_cmd_sleep_hyphen_log_print = \
+  SL_CLI_COMMAND(printSleepLog,
+                 "Print sleep decision counters and the latest sleep decisions.",
+                  "",
+                 {SL_CLI_ARG_END, });
+
+static const sl_cli_command_info_t cli_cmd_sleep_hyphen_log_reset = \
+  SL_CLI_COMMAND(resetSleepLog,
+                 "Clear sleep decision counters and log.",
+                  "",
+                 {SL_CLI_ARG_END, });
+
 static const sl_cli_command_info_t cli_cmd_mfg_hyphen_token_get = \
   SL_CLI_COMMAND(getSetMfgToken,
                  "Print MFG token.",
@@ -413,6 +481,24 @@ static const sl_cli_command_info_t cli_cmd_counters_send_hyphen_request = \
                   "",
                  {SL_CLI_ARG_END, });
 
+static const sl_cli_command_info_t cli_cmd_counters_metrics_hyphen_print = \
+  SL_CLI_COMMAND(sl_zigbee_af_counters_metrics_print_command,
+                 "Prints the counter rates and histograms.",
+                  "",
+                 {SL_CLI_ARG_END, });
+
+static const sl_cli_command_info_t cli_cmd_counters_metrics_hyphen_clear = \
+  SL_CLI_COMMAND(sl_zigbee_af_counters_metrics_clear_command,
+                 "Clears the counter rates and histograms.",
+                  "",
+                 {SL_CLI_ARG_END, });
+
+static const sl_cli_command_info_t cli_cmd_counters_send_hyphen_metrics_hyphen_request = \
+  SL_CLI_COMMAND(sl_zigbee_af_counters_send_metrics_request_command,
+                 "Sends a request for OTA counter rates and histograms.",
+                  "Destination node ID" SL_CLI_UNIT_SEPARATOR,
+                 {SL_CLI_ARG_UINT16, SL_CLI_ARG_END, });
+
 static const sl_cli_command_info_t cli_cmd_enable_type_stack = \
   SL_CLI_COMMAND(sli_zigbee_debug_print_enable_stack_type_command,
                  "Enable/disable debug `stack` print type.",
@@ -527,6 +613,18 @@ static const sl_cli_command_info_t cli_cmd_reporting_test_hyphen_timing = \
                   "",
                  {SL_CLI_ARG_END, });
 
+static const sl_cli_command_info_t cli_cmd_reporting_stats = \
+  SL_CLI_COMMAND(sli_zigbee_af_reporting_cli_stats,
+                 "Prints the number of report commands and attribute records sent.",
+                  "",
+                 {SL_CLI_ARG_END, });
+
+static const sl_cli_command_info_t cli_cmd_reporting_clear_hyphen_stats = \
+  SL_CLI_COMMAND(sli_zigbee_af_reporting_cli_clear_stats,
+                 "Clears the reporting statistics.",
+                  "",
+                 {SL_CLI_ARG_END, });
+
 static const sl_cli_command_info_t cli_cmd_idle_hyphen_sleep_status = \
   SL_CLI_COMMAND(sl_zigbee_af_idle_sleep_status_command,
                  "Display the sleep status",
@@ -972,6 +1070,38 @@ static const sl_cli_command_entry_t endpoints_group_table[] = {
 static const sl_cli_command_info_t cli_cmd_grp_endpoints = \
   SL_CLI_COMMAND_GROUP(endpoints_group_table, "endpoint related commands.");
 
+static const sl_cli_command_entry_t event_hyphen_profile_group_table[] = {
+  { "print", &cli_cmd_event_hyphen_profile_print, false },
+  { "reset", &cli_cmd_event_hyphen_profile_reset, false },
+  { NULL, NULL, false },
+};
+static const sl_cli_command_info_t cli_cmd_grp_event_hyphen_profile = \
+  SL_CLI_COMMAND_GROUP(event_hyphen_profile_group_table, "Event handler profiling commands.");
+
+static const sl_cli_command_entry_t process_hyphen_action_hyphen_profile_group_table[] = {
+  { "print", &cli_cmd_process_hyphen_action_hyphen_profile_print, false },
+  { "reset", &cli_cmd_process_hyphen_action_hyphen_profile_reset, false },
+  { NULL, NULL, false },
+};
+static const sl_cli_command_info_t cli_cmd_grp_process_hyphen_action_hyphen_profile = \
+  SL_CLI_COMMAND_GROUP(process_hyphen_action_hyphen_profile_group_table, "Main loop process action profiling commands.");
+
+static const sl_cli_command_entry_t power_hyphen_stats_group_table[] = {
+  { "print", &cli_cmd_power_hyphen_stats_print, false },
+  { "reset", &cli_cmd_power_hyphen_stats_reset, false },
+  { NULL, NULL, false },
+};
+static const sl_cli_command_info_t cli_cmd_grp_power_hyphen_stats = \
+  SL_CLI_COMMAND_GROUP(power_hyphen_stats_group_table, "Power manager energy mode statistics commands.");
+
+static const sl_cli_command_entry_t sleep_hyphen_log_group_table[] = {
+  { "print", &cli_cmd_sleep_hyphen_log_print, false },
+  { "reset", &cli_cmd_sleep_hyphen_log_reset, false },
+  { NULL, NULL, false },
+};
+static const sl_cli_command_info_t cli_cmd_grp_sleep_hyphen_log = \
+  SL_CLI_COMMAND_GROUP(sleep_hyphen_log_group_table, "Sleep decision telemetry commands.");
+
 static const sl_cli_command_entry_t mfg_hyphen_token_group_table[] = {
   { "get", &cli_cmd_mfg_hyphen_token_get, false },
   { "set", &cli_cmd_mfg_hyphen_token_set, false },
@@ -1008,6 +1138,9 @@ static const sl_cli_command_entry_t counters_group_table[] = {
   { "set-threshold", &cli_cmd_counters_set_hyphen_threshold, false },
   { "reset-thresholds", &cli_cmd_counters_reset_hyphen_thresholds, false },
   { "send-request", &cli_cmd_counters_send_hyphen_request, false },
+  { "metrics-print", &cli_cmd_counters_metrics_hyphen_print, false },
+  { "metrics-clear", &cli_cmd_counters_metrics_hyphen_clear, false },
+  { "send-metrics-request", &cli_cmd_counters_send_hyphen_metrics_hyphen_request, false },
   { NULL, NULL, false },
 };
 static const sl_cli_command_info_t cli_cmd_grp_counters = \
@@ -1065,6 +1198,8 @@ static const sl_cli_command_entry_t reporting_group_table[] = {
   { "add", &cli_cmd_reporting_add, false },
   { "clear-last-report-time", &cli_cmd_reporting_clear_hyphen_last_hyphen_report_hyphen_time, false },
   { "test-timing", &cli_cmd_reporting_test_hyphen_timing, false },
+  { "stats", &cli_cmd_reporting_stats, false },
+  { "clear-stats", &cli_cmd_reporting_clear_hyphen_stats, false },
   { NULL, NULL, false },
 };
 static const sl_cli_command_info_t cli_cmd_grp_reporting = \
@@ -1271,6 +1406,11 @@ const sl_cli_command_entry_t sl_cli_default_command_table[] = {
   { "config-cca-mode", &cli_cmd__config_hyphen_cca_hyphen_mode, false },
   { "version", &cli_cmd__version, false },
   { "events", &cli_cmd__events, false },
+  { "event-profile", &cli_cmd_grp_event_hyphen_profile, false },
+  { "process-action-profile", &cli_cmd_grp_process_hyphen_action_hyphen_profile, false },
+  { "boot-trace", &cli_cmd__boot_hyphen_trace, false },
+  { "power-stats", &cli_cmd_grp_power_hyphen_stats, false },
+  { "sleep-log", &cli_cmd_grp_sleep_hyphen_log, false },
   { "endpoints", &cli_cmd_grp_endpoints, false },
   { "security", &cli_cmd_grp_security, false },
   { "zigbee_print", &cli_cmd_grp_zigbee_print, false },
@@ -96,6 +96,9 @@ void sl_internal_app_init(void)
 
 void sli_platform_process_action(void)
 {
+#if (SL_SE_MANAGER_ASYNC_QUEUE_SIZE > 0)
+  sl_se_process_action();
+#endif
 }
 
 void sli_service_process_action(void)
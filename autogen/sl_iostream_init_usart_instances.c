@@ -62,6 +62,9 @@ sl_iostream_t *sl_iostream_vcom_handle = &sl_iostream_vcom.stream;
 sl_iostream_uart_t *sl_iostream_uart_vcom_handle = &sl_iostream_vcom;
 static sl_iostream_usart_context_t  context_vcom;
 static uint8_t  rx_buffer_vcom[SL_IOSTREAM_USART_VCOM_RX_BUFFER_SIZE];
+#if defined(SL_IOSTREAM_USART_VCOM_TX_BUFFER_SIZE) && (SL_IOSTREAM_USART_VCOM_TX_BUFFER_SIZE > 0)
+static uint8_t  tx_buffer_vcom[SL_IOSTREAM_USART_VCOM_TX_BUFFER_SIZE];
+#endif
 static sli_iostream_uart_periph_t uart_periph_vcom = {
   .rx_irq_number = SL_IOSTREAM_USART_RX_IRQ_NUMBER(SL_IOSTREAM_USART_VCOM_PERIPHERAL_NO),
 #if defined(SL_CATALOG_POWER_MANAGER_PRESENT)
@@ -140,6 +143,12 @@ sl_status_t sl_iostream_usart_init_vcom(void)
   uart_config_vcom.sw_flow_control = SL_IOSTREAM_USART_VCOM_FLOW_CONTROL_TYPE == uartFlowControlSoftware;
 
 
+#if defined(SL_IOSTREAM_USART_VCOM_TX_BUFFER_SIZE) && (SL_IOSTREAM_USART_VCOM_TX_BUFFER_SIZE > 0)
+  uart_config_vcom.tx_buffer = tx_buffer_vcom;
+  uart_config_vcom.tx_buffer_length = SL_IOSTREAM_USART_VCOM_TX_BUFFER_SIZE;
+  uart_config_vcom.tx_policy = SL_IOSTREAM_USART_VCOM_TX_BUFFER_POLICY;
+#endif
+
 #if defined(SL_IOSTREAM_USART_VCOM_ASYNC_TX)
   uart_config_vcom.async_tx_enabled = SL_IOSTREAM_USART_VCOM_ASYNC_TX;
 #else
@@ -5,6 +5,7 @@
 #include "sl_cli_instances.h"
 #include "sl_iostream_init_usart_instances.h"
 #include "sl_legacy_hal_integration_hooks.h"
+#include "sl_se_manager.h"
 #include "sl_zigbee_system_common.h"
 
 /***************************************************************************//**
@@ -68,6 +69,11 @@ bool sl_power_manager_is_ok_to_sleep(void)
   if (sli_zigbee_stack_is_ok_to_sleep() == false) {
     ok_to_sleep = false;
   }
+#if (SL_SE_MANAGER_ASYNC_QUEUE_SIZE > 0)
+  if (sl_se_async_is_idle() == false) {
+    ok_to_sleep = false;
+  }
+#endif
   // Application hook
   if (app_is_ok_to_sleep() == false) {
     ok_to_sleep = false;
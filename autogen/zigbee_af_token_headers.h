@@ -21,5 +21,6 @@
 // *** Generated file. Do not edit! ***
 //
 
+#include "app/framework/plugin/network-steering/network-steering-tokens.h"
 #include "app/framework/plugin/reporting/reporting-tokens.h"
 
@@ -23,6 +23,16 @@
 // <i> This will provide the ability to retreive counters over the air
 #define SL_ZIGBEE_AF_PLUGIN_COUNTERS_OTA   0
 
+// <q SL_ZIGBEE_AF_PLUGIN_COUNTERS_METRICS> Counter rates and histograms
+// <i> Default: FALSE
+// <i> Keeps per-minute and per-hour event rates for every counter, and log-bucketed histograms of MAC retries, APS retries and APS ack latency. The rates and retry histograms are fed from the counter events of an SoC. The metrics can be printed from the CLI and, when counters can be retrieved over the air, requested by a remote node.
+#define SL_ZIGBEE_AF_PLUGIN_COUNTERS_METRICS   0
+
+// <o SL_ZIGBEE_AF_PLUGIN_COUNTERS_METRICS_HISTOGRAM_BUCKETS> Histogram buckets <4-16>
+// <i> Default: 12
+// <i> The number of buckets in each histogram. Bucket 0 counts the value 0 and bucket n counts values from 2^(n-1) to 2^n - 1. The last bucket also counts every larger value.
+#define SL_ZIGBEE_AF_PLUGIN_COUNTERS_METRICS_HISTOGRAM_BUCKETS   12
+
 // </h>
 
 // <<< end of configuration section >>>
@@ -28,6 +28,21 @@
 // <i> How long the initiator will listen for target responses, in milliseconds.
 #define SL_ZIGBEE_AF_PLUGIN_FIND_AND_BIND_INITIATOR_TARGET_RESPONSES_DELAY_MS   MILLISECOND_TICKS_PER_SECOND * 3
 
+// <o SL_ZIGBEE_AF_PLUGIN_FIND_AND_BIND_INITIATOR_DISCOVERIES_IN_FLIGHT> Discoveries in flight <1-4>
+// <i> Default: 1
+// <i> The number of IEEE address and simple descriptor requests the initiator keeps outstanding at once. With a value above 1, the requests for different targets are pipelined instead of being sent one target at a time. Each request uses one of the service discovery states shared with the rest of the application.
+#define SL_ZIGBEE_AF_PLUGIN_FIND_AND_BIND_INITIATOR_DISCOVERIES_IN_FLIGHT   1
+
+// <o SL_ZIGBEE_AF_PLUGIN_FIND_AND_BIND_INITIATOR_CACHE_SIZE> Discovery cache size <0-32>
+// <i> Default: 0
+// <i> The number of (node, endpoint) pairs for which the simple descriptor is remembered between find and bind runs. The IEEE address of every target is still requested, and a cached descriptor is only used when the target answers with the same IEEE address. A value of 0 disables the cache.
+#define SL_ZIGBEE_AF_PLUGIN_FIND_AND_BIND_INITIATOR_CACHE_SIZE   0
+
+// <o SL_ZIGBEE_AF_PLUGIN_FIND_AND_BIND_INITIATOR_CACHE_TTL_S> Discovery cache lifetime (seconds) <1-86400>
+// <i> Default: 300
+// <i> How long a cached simple descriptor is used before it is requested again.
+#define SL_ZIGBEE_AF_PLUGIN_FIND_AND_BIND_INITIATOR_CACHE_TTL_S   300
+
 // </h>
 
 // <<< end of configuration section >>>
@@ -53,6 +53,31 @@
 // <i> When enabled, network steering will attempt to join each network using the install code derived key, centralized key, and distributed key at the same time, rather than trying each key individually. Users that wish to prioritize joining using install code keys should not check this option.
 #define SL_ZIGBEE_AF_PLUGIN_NETWORK_STEERING_TRY_ALL_KEYS   0
 
+// <q SL_ZIGBEE_AF_PLUGIN_NETWORK_STEERING_RANK_BEACONS> Rank cached beacons
+// <i> Default: FALSE
+// <i> Only used when Optimize scans is enabled. When enabled, the cached beacons are tried in order of link quality, depth, advertised capacity and past join failures instead of in the order they were received.
+#define SL_ZIGBEE_AF_PLUGIN_NETWORK_STEERING_RANK_BEACONS   0
+
+// <o SL_ZIGBEE_AF_PLUGIN_NETWORK_STEERING_JOIN_HISTORY_SIZE> Join history size <1-16>
+// <i> Default: 4
+// <i> The number of networks, identified by extended PAN ID, for which join failures and the last successful join are remembered when ranking beacons.
+#define SL_ZIGBEE_AF_PLUGIN_NETWORK_STEERING_JOIN_HISTORY_SIZE   4
+
+// <q SL_ZIGBEE_AF_PLUGIN_NETWORK_STEERING_PERSIST_JOIN_HISTORY> Persist join history
+// <i> Default: FALSE
+// <i> Only used when Rank cached beacons is enabled on an SoC. When enabled, the join history is stored in NVM3 so that it survives a reboot, and steering first scans the channel of the last joined network before scanning the full channel masks.
+#define SL_ZIGBEE_AF_PLUGIN_NETWORK_STEERING_PERSIST_JOIN_HISTORY   0
+
+// <q SL_ZIGBEE_AF_PLUGIN_NETWORK_STEERING_ADAPTIVE_CHANNEL_ORDER> Adaptive channel order
+// <i> Default: FALSE
+// <i> Requires Optimize scans to be disabled. When enabled, the plugin keeps per-channel join and beacon statistics, scans the channels with the best history first and uses the short scan duration on primary channels where nothing has been heard recently. Secondary channel scans always use the full scan duration. On an SoC, the statistics are stored in NVM3 at the end of every steering run so that they survive a reboot.
+#define SL_ZIGBEE_AF_PLUGIN_NETWORK_STEERING_ADAPTIVE_CHANNEL_ORDER   0
+
+// <o SL_ZIGBEE_AF_PLUGIN_NETWORK_STEERING_SHORT_SCAN_DURATION> Short scan duration exponent <0-14>
+// <i> Default: 2
+// <i> The scan duration exponent used for quiet primary channels when Adaptive channel order is enabled.
+#define SL_ZIGBEE_AF_PLUGIN_NETWORK_STEERING_SHORT_SCAN_DURATION   2
+
 // <q SL_ZIGBEE_AF_PLUGIN_NETWORK_STEERING_ENABLE_AUTOSTART> Enable steering auto-start
 // <i> Default: TRUE
 // <i> Provides a configuration for applications to control the behavior of sl_zigbee_af_network_steering_autostart.  That function will call sl_zigbee_af_network_steering_start when this configured enabled and do nothing if it is disabled.  Can be used for testing, which may need more predictability over when network steering is started to get more consistent results.
@@ -27,6 +27,15 @@
 // <i> Default: 4
 #define SL_PSA_KEY_USER_SLOT_COUNT     (4)
 
+// <o SL_PSA_KEY_SLOT_ID_INDEX_SIZE> PSA Key Slot ID Index Size <0-256>
+// <i> Number of entries in an index from persistent key ID to the key slot
+// <i> caching that key. With the index, looking up a persistent key that is
+// <i> already loaded does not scan all key slots. Each entry takes 2 bytes of
+// <i> RAM. A power of two somewhat larger than the number of persistent keys
+// <i> in use keeps collisions rare. 0 disables the index.
+// <i> Default: 0
+#define SL_PSA_KEY_SLOT_ID_INDEX_SIZE  (0)
+
 // <o SL_PSA_ITS_USER_MAX_FILES> Maximum User Persistent PSA Key Count <0-1024>
 // <i> Maximum amount of keys (or other files) that can be stored persistently
 // <i> by the user application, when PSA ITS (Internal Trusted Storage) support
@@ -38,6 +38,11 @@
 // <i> This feature is enabled by default to satisfy zigbee 3.0 compliance. Network commissioners should handle reports over group bindings with caution as the frequency and number of reports over multicasts can stagnate the network. Multicasts are treated as broadcasts, which consume network bandwidth.
 #define SL_ZIGBEE_AF_PLUGIN_REPORTING_ENABLE_GROUP_BOUND_REPORTS   1
 
+// <o SL_ZIGBEE_AF_PLUGIN_REPORTING_COALESCE_WINDOW_MS> Report coalescing window (ms) <0-60000>
+// <i> Default: 0
+// <i> When a report is sent, reports for the same endpoint and cluster whose maximum interval expires within this window are sent early in the same Report Attributes command, saving a transmission. Minimum intervals are always respected. 0 disables coalescing.
+#define SL_ZIGBEE_AF_PLUGIN_REPORTING_COALESCE_WINDOW_MS   0
+
 // </h>
 
 // <<< end of configuration section >>>
@@ -23,6 +23,21 @@
 // <i> The size of the queue of consumers.
 #define SL_ZIGBEE_AF_PLUGIN_SCAN_DISPATCH_SCAN_QUEUE_SIZE   10
 
+// <q SL_ZIGBEE_AF_PLUGIN_SCAN_DISPATCH_MERGE_REQUESTS> Merge compatible scan requests
+// <i> Default: FALSE
+// <i> Pending requests with the same scan type and duration are served by a single radio scan over all of their channels.
+#define SL_ZIGBEE_AF_PLUGIN_SCAN_DISPATCH_MERGE_REQUESTS   0
+
+// <o SL_ZIGBEE_AF_PLUGIN_SCAN_DISPATCH_BEACON_CACHE_SIZE> Beacon cache size <0-64>
+// <i> Default: 0
+// <i> The number of active scan results cached to answer repeated scans of the same channels. 0 disables the cache.
+#define SL_ZIGBEE_AF_PLUGIN_SCAN_DISPATCH_BEACON_CACHE_SIZE   0
+
+// <o SL_ZIGBEE_AF_PLUGIN_SCAN_DISPATCH_BEACON_CACHE_TIMEOUT_MS> Beacon cache timeout (ms) <100-600000>
+// <i> Default: 5000
+// <i> How long the cached results of a channel are used instead of scanning it again.
+#define SL_ZIGBEE_AF_PLUGIN_SCAN_DISPATCH_BEACON_CACHE_TIMEOUT_MS   5000
+
 // </h>
 
 // <<< end of configuration section >>>
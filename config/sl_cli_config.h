@@ -117,6 +117,15 @@
 // <i> If enabled, the CLI will ignore the case for commands.
 #define SL_CLI_IGNORE_COMMAND_CASE     1
 
+// <o SL_CLI_COMMAND_INDEX_SIZE> Size of command lookup index <0-1024>
+// <i> Default: 0
+// <i> Number of slots in the hash index used to look up commands. Must be
+// <i> zero or a power of two, and should be larger than the number of names
+// <i> in all command tables. Set to 0 to search the command tables linearly.
+// <i> Only exact command lookups use the index, tab completion still walks
+// <i> the command tables.
+#define SL_CLI_COMMAND_INDEX_SIZE      0
+
 #endif // SL_CLI_CONFIG_H
 
 // <<< end of configuration section >>>
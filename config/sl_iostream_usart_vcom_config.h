@@ -67,6 +67,19 @@
 // <i> Default: 32
 #define SL_IOSTREAM_USART_VCOM_RX_BUFFER_SIZE    32
 
+// <o SL_IOSTREAM_USART_VCOM_TX_BUFFER_SIZE> Transmit buffer size
+// <i> Ring buffer drained in the background by the TX DMA. Must be a power of two.
+// <i> 0 disables buffering, writes then return once the last byte is handed to the USART.
+// <i> Default: 0
+#define SL_IOSTREAM_USART_VCOM_TX_BUFFER_SIZE    0
+
+// <o SL_IOSTREAM_USART_VCOM_TX_BUFFER_POLICY> Transmit buffer full policy
+// <SL_IOSTREAM_UART_TX_POLICY_BLOCK=> Wait for room
+// <SL_IOSTREAM_UART_TX_POLICY_DROP=> Drop newest data
+// <SL_IOSTREAM_UART_TX_POLICY_OVERWRITE=> Overwrite oldest data
+// <i> Default: SL_IOSTREAM_UART_TX_POLICY_BLOCK
+#define SL_IOSTREAM_USART_VCOM_TX_BUFFER_POLICY  SL_IOSTREAM_UART_TX_POLICY_BLOCK
+
 // <q SL_IOSTREAM_USART_VCOM_CONVERT_BY_DEFAULT_LF_TO_CRLF> Convert \n to \r\n
 // <i> It can be changed at runtime using the C API.
 // <i> Default: 0
@@ -0,0 +1,52 @@
+/***************************************************************************//**
+ * @file
+ * @brief sl_main Boot Trace Configuration
+ *******************************************************************************
+ * # License
+ * <b>Copyright 2025 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * SPDX-License-Identifier: Zlib
+ *
+ * The licensor of this software is Silicon Laboratories Inc.
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ ******************************************************************************/
+
+#ifndef SL_MAIN_BOOT_TRACE_CONFIG_H
+#define SL_MAIN_BOOT_TRACE_CONFIG_H
+
+// <<< Use Configuration Wizard in Context Menu >>>
+
+// <h> Boot Trace Configuration
+
+// <q SL_MAIN_BOOT_TRACE_ENABLED> Record a timestamp at every initialization step.
+// <i> Default: 0
+// <i> The trace covers the current boot only and is restarted on every reset.
+#define SL_MAIN_BOOT_TRACE_ENABLED     0
+
+// <o SL_MAIN_BOOT_TRACE_SIZE> Number of boot trace entries <4-255>
+// <i> Default: 32
+// <i> Steps recorded after the trace is full are counted but not stored.
+#define SL_MAIN_BOOT_TRACE_SIZE        32
+
+// </h>
+
+// <<< end of configuration section >>>
+
+#endif // SL_MAIN_BOOT_TRACE_CONFIG_H
@@ -0,0 +1,54 @@
+/***************************************************************************//**
+ * @file
+ * @brief sl_main Process Action Configuration
+ *******************************************************************************
+ * # License
+ * <b>Copyright 2025 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * SPDX-License-Identifier: Zlib
+ *
+ * The licensor of this software is Silicon Laboratories Inc.
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ ******************************************************************************/
+
+#ifndef SL_MAIN_PROCESS_ACTION_CONFIG_H
+#define SL_MAIN_PROCESS_ACTION_CONFIG_H
+
+// <<< Use Configuration Wizard in Context Menu >>>
+
+// <h> Main Loop Profiling Configuration
+
+// <q SL_MAIN_PROCESS_ACTION_PROFILING> Measure the time spent in each process action.
+// <i> Default: 0
+// <i> Time every main loop phase and every component process action with the
+// <i> DWT cycle counter, and keep a histogram of the cycle counts per action.
+#define SL_MAIN_PROCESS_ACTION_PROFILING           0
+
+// <o SL_MAIN_PROCESS_ACTION_BUDGET_CYCLES> Cycle budget per process action <0-4294967295>
+// <i> Default: 0
+// <i> Process actions taking more cycles than this are counted as over budget.
+// <i> Set to 0 to disable the budget check.
+#define SL_MAIN_PROCESS_ACTION_BUDGET_CYCLES       0
+
+// </h>
+
+// <<< end of configuration section >>>
+
+#endif // SL_MAIN_PROCESS_ACTION_CONFIG_H
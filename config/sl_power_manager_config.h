@@ -57,6 +57,19 @@
 #define SL_POWER_MANAGER_DEBUG_POOL_SIZE  10
 // </e>
 
+// <e SL_POWER_MANAGER_STATISTICS> Enable energy mode statistics
+// <i> Accumulate the time spent in each energy mode, the number of wake-ups and
+// <i> their interrupt source, and the number of sleeps that were rejected or
+// <i> limited to EM1. Read with sl_power_manager_get_statistics().
+// <i> Default: 0
+#define SL_POWER_MANAGER_STATISTICS  0
+
+// <o SL_POWER_MANAGER_STATISTICS_WAKEUP_SOURCE_COUNT> Number of wake-up interrupt sources tracked <1-32>
+// <i> Wake-ups from interrupts that do not fit in the table are counted together.
+// <i> Default: 8
+#define SL_POWER_MANAGER_STATISTICS_WAKEUP_SOURCE_COUNT  8
+// </e>
+
 // <o SL_POWER_MANAGER_INIT_EMU_EM4_PIN_RETENTION_MODE> Pin retention mode
 // <i>
 // <EMU_EM4CTRL_EM4IORETMODE_DISABLE=> No retention
@@ -0,0 +1,28 @@
+/***************************************************************************//**
+ * @brief Zigbee Security Manager configuration header.
+ *\n*******************************************************************************
+ * # License
+ * <b>Copyright 2025 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * The licensor of this software is Silicon Laboratories Inc. Your use of this
+ * software is governed by the terms of Silicon Labs Master Software License
+ * Agreement (MSLA) available at
+ * www.silabs.com/about-us/legal/master-software-license-agreement. This
+ * software is distributed to you in Source Code format and is governed by the
+ * sections of the MSLA applicable to Source Code.
+ *
+ ******************************************************************************/
+
+// <<< Use Configuration Wizard in Context Menu >>>
+
+// <h>Zigbee Security Manager configuration
+
+// <o SL_ZIGBEE_SEC_MAN_DERIVED_KEY_CACHE_SIZE> Derived key cache size <0-16>
+// <i> Default: 0
+// <i> Number of derived keys (key-transport, key-load, hashed TC link keys) kept in RAM so that loading them does not redo the AES-MMO derivation. Entries are wiped whenever a key is stored or deleted. Set to 0 to disable.
+#define SL_ZIGBEE_SEC_MAN_DERIVED_KEY_CACHE_SIZE   0
+
+// </h>
+
+// <<< end of configuration section >>>
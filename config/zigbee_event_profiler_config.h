@@ -0,0 +1,34 @@
+/***************************************************************************//**
+ * @brief Zigbee Application Framework event profiler configuration header.
+ *\n*******************************************************************************
+ * # License
+ * <b>Copyright 2025 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * The licensor of this software is Silicon Laboratories Inc. Your use of this
+ * software is governed by the terms of Silicon Labs Master Software License
+ * Agreement (MSLA) available at
+ * www.silabs.com/about-us/legal/master-software-license-agreement. This
+ * software is distributed to you in Source Code format and is governed by the
+ * sections of the MSLA applicable to Source Code.
+ *
+ ******************************************************************************/
+
+// <<< Use Configuration Wizard in Context Menu >>>
+
+// <h>Zigbee event profiler configuration
+// <o SL_ZIGBEE_EVENT_PROFILER_ENABLED> Event Profiler <0-1>
+// <i> Default: False
+// <i> Enable/Disable timing of application event handlers. Records run
+// <i> count, runtime and scheduling lateness histograms per event, printed
+// <i> by the "event-profile" CLI commands when the core CLI is present.
+#define SL_ZIGBEE_EVENT_PROFILER_ENABLED (0)
+
+// <o SL_ZIGBEE_EVENT_PROFILER_TABLE_SIZE> Event Profiler Table Size <1-255>
+// <i> Default: 16
+// <i> Maximum number of distinct events profiled.
+#define SL_ZIGBEE_EVENT_PROFILER_TABLE_SIZE (16)
+
+// </h>
+
+// <<< end of configuration section >>>
@@ -37,6 +37,16 @@
 // <i> Default: FALSE
 // <i> This will setup the hardware buttons to wake-up or allow the device to go to sleep.  Button 0 will force the device to wake up and stay awake.  Button 1 will turn off this behavior to allow the device to sleep normally. Please note that in order for this option to be fully functional, button 0 and button 1 have to be configured to wake the device from sleep.
 #define SL_ZIGBEE_APP_FRAMEWORK_USE_BUTTON_TO_STAY_AWAKE   0
+
+// <q SL_ZIGBEE_SLEEP_TELEMETRY_ENABLED> Record sleep decisions
+// <i> Default: FALSE
+// <i> Keeps per-reason counters and a log of the latest sleep decisions: the time to the next wakeup, what kept the device out of EM2 and how long it actually slept. Consecutive identical decisions are merged into one log entry.
+#define SL_ZIGBEE_SLEEP_TELEMETRY_ENABLED   0
+
+// <o SL_ZIGBEE_SLEEP_TELEMETRY_LOG_SIZE> Sleep decision log size <2-255>
+// <i> Default: 16
+// <i> Number of sleep decisions kept in the log. The oldest decision is overwritten when the log is full.
+#define SL_ZIGBEE_SLEEP_TELEMETRY_LOG_SIZE   16
 // </h>
 
 // <<< end of configuration section >>>
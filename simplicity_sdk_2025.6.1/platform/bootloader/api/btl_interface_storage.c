@@ -30,6 +30,13 @@
 #pragma GCC diagnostic push
 #pragma GCC diagnostic ignored "-Warray-bounds"
 #endif
+
+// GBL header tag ID, stored little endian at the start of every GBL file
+#define GBL_HEADER_TAG_ID       0x03A617EBUL
+// CRC-32 start value and the residue left after running the CRC over a GBL
+// file including the CRC in its end tag
+#define GBL_CRC32_START         0xFFFFFFFFUL
+#define GBL_CRC32_END           0xDEBB20E3UL
 // -----------------------------------------------------------------------------
 // Static variables
 
@@ -37,9 +44,24 @@
 static Bootloader_PPUSATDnCLKENnState_t blPPUSATDnCLKENnState = { 0 };
 #endif // BOOTLOADER_INTERFACE_TRUSTZONE_AWARE
 
+// Storage backend registered with bootloader_setStorageBackend(), if any
+static const BootloaderStorageFunctions_t *storageBackend = NULL;
+
 // -----------------------------------------------------------------------------
 // Functions
 
+static const BootloaderStorageFunctions_t *getStorageFunctions(void)
+{
+  if (storageBackend != NULL) {
+    return storageBackend;
+  }
+  if (!bootloader_pointerValid(mainBootloaderTable)
+      || !bootloader_pointerValid(mainBootloaderTable->storage)) {
+    return NULL;
+  }
+  return mainBootloaderTable->storage;
+}
+
 static bool verifyAddressRange(uint32_t address,
                                uint32_t length)
 {
@@ -70,17 +92,32 @@ static bool verifyErased(uint32_t address,
   return true;
 }
 
+static uint32_t crc32Update(uint32_t crc, const uint8_t *buffer, size_t length)
+{
+  for (size_t i = 0; i < length; i++) {
+    crc ^= buffer[i];
+    for (uint8_t bit = 0; bit < 8; bit++) {
+      crc = (crc >> 1) ^ (0xEDB88320UL & (0UL - (crc & 1UL)));
+    }
+  }
+  return crc;
+}
+
+void bootloader_setStorageBackend(const BootloaderStorageFunctions_t *backend)
+{
+  storageBackend = backend;
+}
+
 void bootloader_getStorageInfo(BootloaderStorageInformation_t *info)
 {
-  if (!bootloader_pointerValid(mainBootloaderTable)
-      || !bootloader_pointerValid(mainBootloaderTable->storage)) {
+  if (getStorageFunctions() == NULL) {
     return;
   }
 #if defined(BOOTLOADER_INTERFACE_TRUSTZONE_AWARE)
   bootloader_ppusatdnSaveReconfigureState(&blPPUSATDnCLKENnState);
 #endif // BOOTLOADER_INTERFACE_TRUSTZONE_AWARE
 
-  mainBootloaderTable->storage->getInfo(info);
+  getStorageFunctions()->getInfo(info);
 
 #if defined(BOOTLOADER_INTERFACE_TRUSTZONE_AWARE)
   bootloader_ppusatdnRestoreState(&blPPUSATDnCLKENnState);
@@ -90,11 +127,10 @@ void bootloader_getStorageInfo(BootloaderStorageInformation_t *info)
 int32_t bootloader_getStorageSlotInfo(uint32_t                slotId,
                                       BootloaderStorageSlot_t *slot)
 {
-  if (!bootloader_pointerValid(mainBootloaderTable)
-      || !bootloader_pointerValid(mainBootloaderTable->storage)) {
+  if (getStorageFunctions() == NULL) {
     return BOOTLOADER_ERROR_INIT_TABLE;
   }
-  return mainBootloaderTable->storage->getSlotInfo(slotId, slot);
+  return getStorageFunctions()->getSlotInfo(slotId, slot);
 }
 
 int32_t bootloader_readStorage(uint32_t slotId,
@@ -134,8 +170,7 @@ int32_t bootloader_readStorage(uint32_t slotId,
   }
   //END OF INTERNAL_FLASH
   else {
-    if (!bootloader_pointerValid(mainBootloaderTable)
-        || !bootloader_pointerValid(mainBootloaderTable->storage)) {
+    if (getStorageFunctions() == NULL) {
       return BOOTLOADER_ERROR_INIT_TABLE;
     }
 
@@ -143,7 +178,7 @@ int32_t bootloader_readStorage(uint32_t slotId,
     bootloader_ppusatdnSaveReconfigureState(&blPPUSATDnCLKENnState);
   #endif // BOOTLOADER_INTERFACE_TRUSTZONE_AWARE
 
-    retVal = mainBootloaderTable->storage->read(slotId, offset, buffer, length);
+    retVal = getStorageFunctions()->read(slotId, offset, buffer, length);
 
   #if defined(BOOTLOADER_INTERFACE_TRUSTZONE_AWARE)
     bootloader_ppusatdnRestoreState(&blPPUSATDnCLKENnState);
@@ -187,8 +222,7 @@ int32_t bootloader_writeStorage(uint32_t slotId,
                                         buffer,
                                         length);
   } else {
-    if (!bootloader_pointerValid(mainBootloaderTable)
-        || !bootloader_pointerValid(mainBootloaderTable->storage)) {
+    if (getStorageFunctions() == NULL) {
       return BOOTLOADER_ERROR_INIT_TABLE;
     }
 
@@ -196,7 +230,7 @@ int32_t bootloader_writeStorage(uint32_t slotId,
     bootloader_ppusatdnSaveReconfigureState(&blPPUSATDnCLKENnState);
   #endif // BOOTLOADER_INTERFACE_TRUSTZONE_AWARE
 
-    retVal = mainBootloaderTable->storage->write(slotId, offset, buffer, length);
+    retVal = getStorageFunctions()->write(slotId, offset, buffer, length);
 
   #if defined(BOOTLOADER_INTERFACE_TRUSTZONE_AWARE)
     bootloader_ppusatdnRestoreState(&blPPUSATDnCLKENnState);
@@ -219,8 +253,7 @@ int32_t bootloader_eraseWriteStorage(uint32_t slotId,
   BootloaderStorageSlot_t storageSlot;
   BootloaderStorageInformation_t storageInfo;
 
-  if (!bootloader_pointerValid(mainBootloaderTable)
-      || !bootloader_pointerValid(mainBootloaderTable->storage)) {
+  if (getStorageFunctions() == NULL) {
     return BOOTLOADER_ERROR_INIT_TABLE;
   }
 
@@ -315,8 +348,7 @@ int32_t bootloader_eraseStorageSlot(uint32_t slotId)
 
     retVal = bootloader_eraseRawStorage(storageSlot.address, storageSlot.length);
   } else {
-    if (!bootloader_pointerValid(mainBootloaderTable)
-        || !bootloader_pointerValid(mainBootloaderTable->storage)) {
+    if (getStorageFunctions() == NULL) {
       return BOOTLOADER_ERROR_INIT_TABLE;
     }
 
@@ -324,7 +356,7 @@ int32_t bootloader_eraseStorageSlot(uint32_t slotId)
     bootloader_ppusatdnSaveReconfigureState(&blPPUSATDnCLKENnState);
   #endif // BOOTLOADER_INTERFACE_TRUSTZONE_AWARE
 
-    retVal = mainBootloaderTable->storage->erase(slotId);
+    retVal = getStorageFunctions()->erase(slotId);
 
   #if defined(BOOTLOADER_INTERFACE_TRUSTZONE_AWARE)
     bootloader_ppusatdnRestoreState(&blPPUSATDnCLKENnState);
@@ -374,10 +406,81 @@ int32_t bootloader_chunkedEraseStorageSlot(BootloaderEraseStatus_t *eraseStat)
   return BOOTLOADER_ERROR_STORAGE_CONTINUE;
 }
 
+int32_t bootloader_initStreamStorage(uint32_t                 slotId,
+                                     BootloaderStreamStatus_t *stream)
+{
+  int32_t retVal;
+
+  stream->slotId = slotId;
+  stream->offset = 0;
+  stream->crc = GBL_CRC32_START;
+  retVal = bootloader_initChunkedEraseStorageSlot(slotId, &stream->eraseStat);
+  if (retVal != BOOTLOADER_OK) {
+    return retVal;
+  }
+  if (stream->eraseStat.pageSize == 0) {
+    return BOOTLOADER_ERROR_STORAGE_INVALID_SLOT;
+  }
+  return BOOTLOADER_OK;
+}
+
+int32_t bootloader_streamEraseStorage(BootloaderStreamStatus_t *stream)
+{
+  return bootloader_chunkedEraseStorageSlot(&stream->eraseStat);
+}
+
+int32_t bootloader_streamWriteStorage(BootloaderStreamStatus_t *stream,
+                                      uint8_t                  *buffer,
+                                      size_t                   length)
+{
+  int32_t retVal;
+  uint32_t endAddr = stream->eraseStat.storageSlotInfo.address
+                     + stream->offset + length;
+
+  if ((stream->offset + length > stream->eraseStat.storageSlotInfo.length)
+      || (length > stream->eraseStat.storageSlotInfo.length)) {
+    return BOOTLOADER_ERROR_STORAGE_INVALID_ADDRESS;
+  }
+
+  // Fail early on anything that is not a GBL file rather than after the
+  // whole download
+  if (stream->offset == 0
+      && (length < 4
+          || (buffer[0] | (buffer[1] << 8) | (buffer[2] << 16)
+              | ((uint32_t)buffer[3] << 24)) != GBL_HEADER_TAG_ID)) {
+    return BOOTLOADER_ERROR_PARSER_FILETYPE;
+  }
+
+  // Erase only the pages this block lands in; pages further ahead are left
+  // to bootloader_streamEraseStorage so erasing overlaps with reception.
+  while (stream->eraseStat.currentPageAddr < endAddr) {
+    retVal = bootloader_chunkedEraseStorageSlot(&stream->eraseStat);
+    if (retVal != BOOTLOADER_OK && retVal != BOOTLOADER_ERROR_STORAGE_CONTINUE) {
+      return retVal;
+    }
+  }
+
+  retVal = bootloader_writeStorage(stream->slotId, stream->offset, buffer, length);
+  if (retVal != BOOTLOADER_OK) {
+    return retVal;
+  }
+
+  stream->crc = crc32Update(stream->crc, buffer, length);
+  stream->offset += length;
+  return BOOTLOADER_OK;
+}
+
+int32_t bootloader_finishStreamStorage(const BootloaderStreamStatus_t *stream)
+{
+  if (stream->crc != GBL_CRC32_END) {
+    return BOOTLOADER_ERROR_PARSER_CRC;
+  }
+  return BOOTLOADER_OK;
+}
+
 int32_t bootloader_setImageToBootload(int32_t slotId)
 {
-  if (!bootloader_pointerValid(mainBootloaderTable)
-      || !bootloader_pointerValid(mainBootloaderTable->storage)) {
+  if (getStorageFunctions() == NULL) {
     return BOOTLOADER_ERROR_INIT_TABLE;
   }
 
@@ -385,7 +488,7 @@ int32_t bootloader_setImageToBootload(int32_t slotId)
   bootloader_ppusatdnSaveReconfigureState(&blPPUSATDnCLKENnState);
 #endif // BOOTLOADER_INTERFACE_TRUSTZONE_AWARE
 
-  int32_t retVal = mainBootloaderTable->storage->setImagesToBootload(&slotId, 1);
+  int32_t retVal = getStorageFunctions()->setImagesToBootload(&slotId, 1);
 
 #if defined(BOOTLOADER_INTERFACE_TRUSTZONE_AWARE)
   bootloader_ppusatdnRestoreState(&blPPUSATDnCLKENnState);
@@ -396,8 +499,7 @@ int32_t bootloader_setImageToBootload(int32_t slotId)
 
 int32_t bootloader_setImagesToBootload(int32_t *slotIds, size_t length)
 {
-  if (!bootloader_pointerValid(mainBootloaderTable)
-      || !bootloader_pointerValid(mainBootloaderTable->storage)) {
+  if (getStorageFunctions() == NULL) {
     return BOOTLOADER_ERROR_INIT_TABLE;
   }
 
@@ -405,7 +507,7 @@ int32_t bootloader_setImagesToBootload(int32_t *slotIds, size_t length)
   bootloader_ppusatdnSaveReconfigureState(&blPPUSATDnCLKENnState);
 #endif // BOOTLOADER_INTERFACE_TRUSTZONE_AWARE
 
-  int32_t retVal = mainBootloaderTable->storage->setImagesToBootload(slotIds, length);
+  int32_t retVal = getStorageFunctions()->setImagesToBootload(slotIds, length);
 
 #if defined(BOOTLOADER_INTERFACE_TRUSTZONE_AWARE)
   bootloader_ppusatdnRestoreState(&blPPUSATDnCLKENnState);
@@ -416,8 +518,7 @@ int32_t bootloader_setImagesToBootload(int32_t *slotIds, size_t length)
 
 int32_t bootloader_getImagesToBootload(int32_t *slotIds, size_t length)
 {
-  if (!bootloader_pointerValid(mainBootloaderTable)
-      || !bootloader_pointerValid(mainBootloaderTable->storage)) {
+  if (getStorageFunctions() == NULL) {
     return BOOTLOADER_ERROR_INIT_TABLE;
   }
 
@@ -425,7 +526,7 @@ int32_t bootloader_getImagesToBootload(int32_t *slotIds, size_t length)
   bootloader_ppusatdnSaveReconfigureState(&blPPUSATDnCLKENnState);
 #endif // BOOTLOADER_INTERFACE_TRUSTZONE_AWARE
 
-  int32_t retVal = mainBootloaderTable->storage->getImagesToBootload(slotIds, length);
+  int32_t retVal = getStorageFunctions()->getImagesToBootload(slotIds, length);
 
 #if defined(BOOTLOADER_INTERFACE_TRUSTZONE_AWARE)
   bootloader_ppusatdnRestoreState(&blPPUSATDnCLKENnState);
@@ -436,8 +537,7 @@ int32_t bootloader_getImagesToBootload(int32_t *slotIds, size_t length)
 
 int32_t bootloader_appendImageToBootloadList(int32_t slotId)
 {
-  if (!bootloader_pointerValid(mainBootloaderTable)
-      || !bootloader_pointerValid(mainBootloaderTable->storage)) {
+  if (getStorageFunctions() == NULL) {
     return BOOTLOADER_ERROR_INIT_TABLE;
   }
 
@@ -445,7 +545,7 @@ int32_t bootloader_appendImageToBootloadList(int32_t slotId)
   bootloader_ppusatdnSaveReconfigureState(&blPPUSATDnCLKENnState);
 #endif // BOOTLOADER_INTERFACE_TRUSTZONE_AWARE
 
-  int32_t retVal = mainBootloaderTable->storage->appendImageToBootloadList(slotId);
+  int32_t retVal = getStorageFunctions()->appendImageToBootloadList(slotId);
 
 #if defined(BOOTLOADER_INTERFACE_TRUSTZONE_AWARE)
   bootloader_ppusatdnRestoreState(&blPPUSATDnCLKENnState);
@@ -459,12 +559,8 @@ int32_t bootloader_initVerifyImage(uint32_t slotId,
                                    size_t   contextSize)
 {
   int32_t retVal;
-  if (!bootloader_pointerValid(mainBootloaderTable)) {
-    return BOOTLOADER_ERROR_PARSE_STORAGE;
-  }
-
   // Check that the bootloader has image verification capability
-  if (mainBootloaderTable->storage == NULL) {
+  if (getStorageFunctions() == NULL) {
     return BOOTLOADER_ERROR_PARSE_STORAGE;
   }
 
@@ -472,7 +568,7 @@ int32_t bootloader_initVerifyImage(uint32_t slotId,
   bootloader_ppusatdnSaveReconfigureState(&blPPUSATDnCLKENnState);
 #endif // BOOTLOADER_INTERFACE_TRUSTZONE_AWARE
 
-  retVal = mainBootloaderTable->storage->initParseImage(
+  retVal = getStorageFunctions()->initParseImage(
     slotId,
     (BootloaderParserContext_t*)context,
     contextSize);
@@ -487,8 +583,7 @@ int32_t bootloader_initVerifyImage(uint32_t slotId,
 int32_t bootloader_continueVerifyImage(void                       *context,
                                        BootloaderParserCallback_t metadataCallback)
 {
-  if (!bootloader_pointerValid(mainBootloaderTable)
-      || !bootloader_pointerValid(mainBootloaderTable->storage)) {
+  if (getStorageFunctions() == NULL) {
     return BOOTLOADER_ERROR_PARSE_STORAGE;
   }
 
@@ -496,7 +591,7 @@ int32_t bootloader_continueVerifyImage(void                       *context,
   bootloader_ppusatdnSaveReconfigureState(&blPPUSATDnCLKENnState);
 #endif // BOOTLOADER_INTERFACE_TRUSTZONE_AWARE
 
-  int32_t retVal = mainBootloaderTable->storage->verifyImage(
+  int32_t retVal = getStorageFunctions()->verifyImage(
     (BootloaderParserContext_t *)context,
     metadataCallback);
 
@@ -513,7 +608,7 @@ int32_t bootloader_verifyImage(uint32_t                   slotId,
   int32_t retval;
   uint8_t context[BOOTLOADER_STORAGE_VERIFICATION_CONTEXT_SIZE];
 
-  if (!bootloader_pointerValid(mainBootloaderTable)) {
+  if (getStorageFunctions() == NULL) {
     return BOOTLOADER_ERROR_PARSE_STORAGE;
   }
 
@@ -543,19 +638,18 @@ int32_t bootloader_getImageInfo(uint32_t          slotId,
   int32_t retval;
   uint8_t context[BOOTLOADER_STORAGE_VERIFICATION_CONTEXT_SIZE];
 
-  if (!bootloader_pointerValid(mainBootloaderTable)
-      || !bootloader_pointerValid(mainBootloaderTable->storage)) {
+  if (getStorageFunctions() == NULL) {
     return BOOTLOADER_ERROR_PARSE_STORAGE;
   }
 
   // Check that the bootloader has image verification capability
-  BTL_ASSERT(mainBootloaderTable->storage != NULL);
+  BTL_ASSERT(getStorageFunctions() != NULL);
 
 #if defined(BOOTLOADER_INTERFACE_TRUSTZONE_AWARE)
   bootloader_ppusatdnSaveReconfigureState(&blPPUSATDnCLKENnState);
 #endif // BOOTLOADER_INTERFACE_TRUSTZONE_AWARE
 
-  retval = mainBootloaderTable->storage->initParseImage(
+  retval = getStorageFunctions()->initParseImage(
     slotId,
     (BootloaderParserContext_t *)context,
     BOOTLOADER_STORAGE_VERIFICATION_CONTEXT_SIZE);
@@ -565,7 +659,7 @@ int32_t bootloader_getImageInfo(uint32_t          slotId,
 #endif // BOOTLOADER_INTERFACE_TRUSTZONE_AWARE
     return retval;
   }
-  retval = mainBootloaderTable->storage->getImageInfo(
+  retval = getStorageFunctions()->getImageInfo(
     (BootloaderParserContext_t *)context,
     appInfo,
     bootloaderVersion);
@@ -581,15 +675,14 @@ bool bootloader_storageIsBusy(void)
 {
   bool isBusy = false;
 
-  if (!bootloader_pointerValid(mainBootloaderTable)
-      || !bootloader_pointerValid(mainBootloaderTable->storage)) {
+  if (getStorageFunctions() == NULL) {
     return true;
   }
 #if defined(BOOTLOADER_INTERFACE_TRUSTZONE_AWARE)
   bootloader_ppusatdnSaveReconfigureState(&blPPUSATDnCLKENnState);
 #endif // BOOTLOADER_INTERFACE_TRUSTZONE_AWARE
 
-  isBusy = mainBootloaderTable->storage->isBusy();
+  isBusy = getStorageFunctions()->isBusy();
 
 #if defined(BOOTLOADER_INTERFACE_TRUSTZONE_AWARE)
   bootloader_ppusatdnRestoreState(&blPPUSATDnCLKENnState);
@@ -618,15 +711,14 @@ int32_t bootloader_readRawStorage(uint32_t address,
 
     retVal = BOOTLOADER_OK;
   } else {
-    if (!bootloader_pointerValid(mainBootloaderTable)
-        || !bootloader_pointerValid(mainBootloaderTable->storage)) {
+    if (getStorageFunctions() == NULL) {
       return BOOTLOADER_ERROR_INIT_STORAGE;
     }
     #if defined(BOOTLOADER_INTERFACE_TRUSTZONE_AWARE)
     bootloader_ppusatdnSaveReconfigureState(&blPPUSATDnCLKENnState);
     #endif // BOOTLOADER_INTERFACE_TRUSTZONE_AWARE
 
-    retVal = mainBootloaderTable->storage->readRaw(address, buffer, length);
+    retVal = getStorageFunctions()->readRaw(address, buffer, length);
 
     #if defined(BOOTLOADER_INTERFACE_TRUSTZONE_AWARE)
     bootloader_ppusatdnRestoreState(&blPPUSATDnCLKENnState);
@@ -663,8 +755,7 @@ int32_t bootloader_writeRawStorage(uint32_t address,
     }
     //END OF INTERNAL FLASH
   } else {
-    if (!bootloader_pointerValid(mainBootloaderTable)
-        || !bootloader_pointerValid(mainBootloaderTable->storage)) {
+    if (getStorageFunctions() == NULL) {
       return BOOTLOADER_ERROR_INIT_STORAGE;
     }
 
@@ -672,7 +763,7 @@ int32_t bootloader_writeRawStorage(uint32_t address,
     bootloader_ppusatdnSaveReconfigureState(&blPPUSATDnCLKENnState);
     #endif // BOOTLOADER_INTERFACE_TRUSTZONE_AWARE
 
-    retVal = mainBootloaderTable->storage->writeRaw(address, buffer, length);
+    retVal = getStorageFunctions()->writeRaw(address, buffer, length);
 
     #if defined(BOOTLOADER_INTERFACE_TRUSTZONE_AWARE)
     bootloader_ppusatdnRestoreState(&blPPUSATDnCLKENnState);
@@ -684,11 +775,15 @@ int32_t bootloader_writeRawStorage(uint32_t address,
 
 int32_t bootloader_getAllocatedDMAChannel(void)
 {
-  if (!bootloader_pointerValid(mainBootloaderTable)
-      || !bootloader_pointerValid(mainBootloaderTable->storage)) {
+  if (getStorageFunctions() == NULL) {
     return BOOTLOADER_ERROR_INIT_STORAGE;
   }
 
+  // The version check below applies to the bootloader's own storage only
+  if (storageBackend != NULL) {
+    return storageBackend->getDMAchannel();
+  }
+
   BootloaderInformation_t info = { .type = SL_BOOTLOADER, .version = 0U, .capabilities = 0U };
   bootloader_getInfo(&info);
 
@@ -705,7 +800,7 @@ int32_t bootloader_getAllocatedDMAChannel(void)
     return BOOTLOADER_ERROR_INIT_STORAGE;
   }
 
-  return mainBootloaderTable->storage->getDMAchannel();
+  return getStorageFunctions()->getDMAchannel();
 }
 
 int32_t bootloader_eraseRawStorage(uint32_t address,
@@ -745,8 +840,7 @@ int32_t bootloader_eraseRawStorage(uint32_t address,
       retVal = BOOTLOADER_ERROR_STORAGE_INVALID_ADDRESS;
     }
   } else {
-    if (!bootloader_pointerValid(mainBootloaderTable)
-        || !bootloader_pointerValid(mainBootloaderTable->storage)) {
+    if (getStorageFunctions() == NULL) {
       return BOOTLOADER_ERROR_INIT_STORAGE;
     }
 
@@ -754,7 +848,7 @@ int32_t bootloader_eraseRawStorage(uint32_t address,
     bootloader_ppusatdnSaveReconfigureState(&blPPUSATDnCLKENnState);
   #endif // BOOTLOADER_INTERFACE_TRUSTZONE_AWARE
 
-    retVal = mainBootloaderTable->storage->eraseRaw(address, length);
+    retVal = getStorageFunctions()->eraseRaw(address, length);
 
   #if defined(BOOTLOADER_INTERFACE_TRUSTZONE_AWARE)
     bootloader_ppusatdnRestoreState(&blPPUSATDnCLKENnState);
@@ -150,6 +150,20 @@ typedef struct {
   BootloaderStorageSlot_t storageSlotInfo;
 } BootloaderEraseStatus_t;
 
+/// State of a streamed write to a storage slot. The structure holds no
+/// pointers, so it can be saved to persistent storage by the application and
+/// restored after a reset to resume an interrupted download.
+typedef struct {
+  /// ID of the slot being written
+  uint32_t slotId;
+  /// Number of bytes written from the start of the slot
+  uint32_t offset;
+  /// Running CRC-32 of the bytes written so far
+  uint32_t crc;
+  /// Erase progress, pages are erased just ahead of the write offset
+  BootloaderEraseStatus_t eraseStat;
+} BootloaderStreamStatus_t;
+
 /// Storage API accessible from the application
 typedef struct BootloaderStorageFunctions {
   /// Version of this struct
@@ -289,6 +303,21 @@ typedef struct BootloaderStorageFunctions {
 // -----------------------------------------------------------------------------
 // Functions
 
+/***************************************************************************//**
+ * Route the storage interface to a different storage backend.
+ *
+ * @note All storage interface functions call through the given function table
+ *       instead of the bootloader's storage component, which allows the OTA
+ *       storage path to run against, for example, a RAM backed slot. All
+ *       function pointers in the table must be set. A backend that does not
+ *       map its slots into internal flash must report @ref CUSTOM_STORAGE as
+ *       its storage type, so that raw accesses also go through the backend.
+ *
+ * @param[in] backend Storage functions to use, or NULL to use the
+ *                    bootloader's storage component again.
+ ******************************************************************************/
+void bootloader_setStorageBackend(const BootloaderStorageFunctions_t *backend);
+
 /***************************************************************************//**
  * Get information about the storage component.
  *
@@ -417,6 +446,70 @@ int32_t bootloader_initChunkedEraseStorageSlot(uint32_t                slotId,
  ******************************************************************************/
 int32_t bootloader_chunkedEraseStorageSlot(BootloaderEraseStatus_t *eraseStat);
 
+/***************************************************************************//**
+ * Initialize a streamed write of a GBL file to a storage slot.
+ *
+ * @note A streamed write erases the slot page by page just ahead of the data
+ *       written with @ref bootloader_streamWriteStorage, and keeps a running
+ *       CRC of the file so that @ref bootloader_finishStreamStorage can check
+ *       the GBL end tag CRC without reading the slot back. Erasing may be
+ *       done ahead of time between received blocks by calling
+ *       @ref bootloader_streamEraseStorage.
+ *
+ * @param[in]  slotId ID of the slot
+ * @param[out] stream Stream status struct
+ *
+ * @return @ref BOOTLOADER_OK on success, else error code in
+ *         @ref BOOTLOADER_ERROR_STORAGE_BASE range
+ ******************************************************************************/
+int32_t bootloader_initStreamStorage(uint32_t                 slotId,
+                                     BootloaderStreamStatus_t *stream);
+
+/***************************************************************************//**
+ * Erase the next page of a streamed write ahead of the data.
+ *
+ * @param[in] stream Stream status struct
+ *
+ * @return @ref BOOTLOADER_ERROR_STORAGE_CONTINUE if a page was erased and more
+ *         pages remain. @ref BOOTLOADER_OK if the whole slot is erased,
+ *         else error code in @ref BOOTLOADER_ERROR_STORAGE_BASE range
+ ******************************************************************************/
+int32_t bootloader_streamEraseStorage(BootloaderStreamStatus_t *stream);
+
+/***************************************************************************//**
+ * Append data to a streamed write.
+ *
+ * @note Data must be written in order. The pages covered by the data are
+ *       erased first if @ref bootloader_streamEraseStorage has not already
+ *       done so. The first block is rejected if it does not start with a GBL
+ *       header tag.
+ *
+ * @param[in] stream Stream status struct
+ * @param[in] buffer Buffer to read data to write from
+ * @param[in] length Amount of data to write. Must be a multiple of 4.
+ *
+ * @return @ref BOOTLOADER_OK on success, @ref BOOTLOADER_ERROR_PARSER_FILETYPE
+ *         if the data is not a GBL file, else error code in
+ *         @ref BOOTLOADER_ERROR_STORAGE_BASE range
+ ******************************************************************************/
+int32_t bootloader_streamWriteStorage(BootloaderStreamStatus_t *stream,
+                                      uint8_t                  *buffer,
+                                      size_t                   length);
+
+/***************************************************************************//**
+ * Check the CRC of a completed streamed write.
+ *
+ * @note This only checks the integrity of the received file against the CRC in
+ *       its GBL end tag. Use @ref bootloader_verifyImage to authenticate the
+ *       image before installing it.
+ *
+ * @param[in] stream Stream status struct
+ *
+ * @return @ref BOOTLOADER_OK if the file ends with a valid GBL end tag CRC,
+ *         else @ref BOOTLOADER_ERROR_PARSER_CRC
+ ******************************************************************************/
+int32_t bootloader_finishStreamStorage(const BootloaderStreamStatus_t *stream);
+
 /***************************************************************************//**
  * Set a prioritized list of images to attempt to bootload. The last call to
  * this function determines which slot will be installed when
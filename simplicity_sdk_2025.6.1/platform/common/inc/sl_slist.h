@@ -57,6 +57,13 @@ struct sl_slist_node {
   sl_slist_node_t *node; ///< List node
 };
 
+/// List with a tail pointer, for O(1) push back. The head can be walked
+/// with the regular list macros.
+typedef struct {
+  sl_slist_node_t *head; ///< First item of the list
+  sl_slist_node_t *tail; ///< Last item of the list
+} sl_slist_queue_t;
+
 #ifndef DOXYGEN
 #define  container_of(ptr, type, member)  (type *)((uintptr_t)(ptr) - ((uintptr_t)(&((type *)0)->member)))
 
@@ -164,6 +171,42 @@ static inline bool sl_slist_is_empty(sl_slist_node_t *head)
   return head == NULL;
 }
 
+/*******************************************************************************
+ * Initialize a tail-tracking singly-linked list.
+ *
+ * @param    queue  Pointer to the list.
+ ******************************************************************************/
+void sl_slist_queue_init(sl_slist_queue_t *queue);
+
+/*******************************************************************************
+ * Add an item at the end of a tail-tracking list, in constant time.
+ *
+ * @param    queue  Pointer to the list.
+ *
+ * @param    item   Pointer to the item to add.
+ ******************************************************************************/
+void sl_slist_queue_push_back(sl_slist_queue_t *queue,
+                              sl_slist_node_t *item);
+
+/*******************************************************************************
+ * Remove and return the first element of a tail-tracking list.
+ *
+ * @param    queue  Pointer to the list.
+ *
+ * @return   Pointer to item that was at top of the list, NULL if empty.
+ ******************************************************************************/
+sl_slist_node_t *sl_slist_queue_pop(sl_slist_queue_t *queue);
+
+/*******************************************************************************
+ * Checks if a tail-tracking list is empty.
+ *
+ * @param    queue  Pointer to the list.
+ ******************************************************************************/
+static inline bool sl_slist_queue_is_empty(const sl_slist_queue_t *queue)
+{
+  return queue->head == NULL;
+}
+
 /** @} (end addtogroup slist) */
 
 #ifdef __cplusplus
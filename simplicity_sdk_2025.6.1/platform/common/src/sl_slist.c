@@ -149,42 +149,121 @@ void sl_slist_remove(sl_slist_node_t **head,
 
 /***************************************************************************//**
  * Sorts list items.
+ *
+ * Bottom-up merge sort: merges runs of 1, 2, 4, ... items until a single run
+ * is left. Items are taken from the left run while cmp_fnct() reports them
+ * as ordered, which keeps the sort stable.
  ******************************************************************************/
 void sl_slist_sort(sl_slist_node_t **head,
                    bool (*cmp_fnct)(sl_slist_node_t *item_l,
                                     sl_slist_node_t *item_r))
 {
-  bool  swapped;
-  sl_slist_node_t **pp_item_l;
+  sl_slist_node_t *list;
+  size_t run_size = 1;
 
   EFM_ASSERT((head != NULL) && (cmp_fnct != NULL));
 
-  do {
-    swapped = false;
-
-    pp_item_l = head;
-    // Loop until end of list is found.
-    while ((*pp_item_l != NULL) && ((*pp_item_l)->node != NULL)) {
-      sl_slist_node_t *p_item_r = (*pp_item_l)->node;
-      bool  ordered;
-
-      // Call provided compare fnct.
-      ordered = cmp_fnct(*pp_item_l, p_item_r);
-      if (ordered == false) {
-        // If order is not correct, swap items.
-        sl_slist_node_t *p_tmp = p_item_r->node;
-
-        // Swap the two items.
-        p_item_r->node = *pp_item_l;
-        (*pp_item_l)->node = p_tmp;
-        *pp_item_l = p_item_r;
-        pp_item_l = &(p_item_r->node);
-        // Indicate a swap has been done.
-        swapped = true;
-      } else {
-        pp_item_l = &((*pp_item_l)->node);
+  list = *head;
+  if (list == NULL) {
+    return;
+  }
+
+  for (;; ) {
+    sl_slist_node_t *p_item_l = list;
+    sl_slist_node_t **pp_tail = &list;
+    size_t merges = 0;
+
+    while (p_item_l != NULL) {
+      sl_slist_node_t *p_item_r = p_item_l;
+      size_t size_l = 0;
+      size_t size_r = run_size;
+
+      merges++;
+      // Step over the left run to find the start of the right run.
+      while ((size_l < run_size) && (p_item_r != NULL)) {
+        size_l++;
+        p_item_r = p_item_r->node;
       }
+
+      // Merge the two runs.
+      while ((size_l > 0) || ((size_r > 0) && (p_item_r != NULL))) {
+        sl_slist_node_t *p_item;
+
+        if ((size_l > 0)
+            && ((size_r == 0) || (p_item_r == NULL) || cmp_fnct(p_item_l, p_item_r))) {
+          p_item = p_item_l;
+          p_item_l = p_item_l->node;
+          size_l--;
+        } else {
+          p_item = p_item_r;
+          p_item_r = p_item_r->node;
+          size_r--;
+        }
+        *pp_tail = p_item;
+        pp_tail = &(p_item->node);
+      }
+
+      p_item_l = p_item_r;
+    }
+    *pp_tail = NULL;
+
+    if (merges <= 1) {
+      break;
     }
-    // Re-loop until no items have been swapped.
-  } while (swapped == true);
+    run_size *= 2;
+  }
+
+  *head = list;
+}
+
+/***************************************************************************//**
+ * Initializes a tail-tracking singly-linked list.
+ ******************************************************************************/
+void sl_slist_queue_init(sl_slist_queue_t *queue)
+{
+  EFM_ASSERT(queue != NULL);
+
+  queue->head = NULL;
+  queue->tail = NULL;
+}
+
+/***************************************************************************//**
+ * Add item at end of tail-tracking list.
+ ******************************************************************************/
+void sl_slist_queue_push_back(sl_slist_queue_t *queue,
+                              sl_slist_node_t *item)
+{
+  EFM_ASSERT((item != NULL) && (queue != NULL));
+
+  item->node = NULL;
+  if (queue->tail == NULL) {
+    queue->head = item;
+  } else {
+    queue->tail->node = item;
+  }
+  queue->tail = item;
+}
+
+/***************************************************************************//**
+ * Removes and returns first element of tail-tracking list.
+ ******************************************************************************/
+sl_slist_node_t *sl_slist_queue_pop(sl_slist_queue_t *queue)
+{
+  sl_slist_node_t *item;
+
+  EFM_ASSERT(queue != NULL);
+
+  item = queue->head;
+  if (item == NULL) {
+    return (NULL);
+  }
+
+  queue->head = item->node;
+  if (queue->head == NULL) {
+    queue->tail = NULL;
+  }
+
+  item->node = NULL;
+
+  return (item);
 }
@@ -100,6 +100,12 @@ typedef bool (*DMADRV_Callback_t)(unsigned int channel,
                                   unsigned int sequenceNo,
                                   void *userParam);
 
+/// A memory fragment of a scatter-gather transfer.
+typedef struct {
+  void *buffer;   ///< Start address of the fragment.
+  int  len;       ///< A number of items (of transfer item size) in the fragment.
+} DMADRV_IoVec_t;
+
 Ecode_t DMADRV_AllocateChannel(unsigned int *channelId,
                                void         *capabilities);
 Ecode_t DMADRV_AllocateChannelById(unsigned int channelId,
@@ -153,6 +159,26 @@ Ecode_t DMADRV_LdmaStartTransfer(int                channelId,
                                  LDMA_Descriptor_t  *descriptor,
                                  DMADRV_Callback_t  callback,
                                  void               *cbUserParam);
+Ecode_t DMADRV_MemoryPeripheralScatterGather(unsigned int              channelId,
+                                             DMADRV_PeripheralSignal_t peripheralSignal,
+                                             void                      *dst,
+                                             const DMADRV_IoVec_t      *iov,
+                                             unsigned int              iovCount,
+                                             LDMA_Descriptor_t         *descPool,
+                                             unsigned int              descPoolCount,
+                                             DMADRV_DataSize_t         size,
+                                             DMADRV_Callback_t         callback,
+                                             void                      *cbUserParam);
+Ecode_t DMADRV_PeripheralMemoryScatterGather(unsigned int              channelId,
+                                             DMADRV_PeripheralSignal_t peripheralSignal,
+                                             void                      *src,
+                                             const DMADRV_IoVec_t      *iov,
+                                             unsigned int              iovCount,
+                                             LDMA_Descriptor_t         *descPool,
+                                             unsigned int              descPoolCount,
+                                             DMADRV_DataSize_t         size,
+                                             DMADRV_Callback_t         callback,
+                                             void                      *cbUserParam);
 #elif defined(EMDRV_DMADRV_LDMA_S3)
 Ecode_t DMADRV_LdmaStartTransfer(int                            channelId,
                                  sl_hal_ldma_transfer_config_t  *transfer,
@@ -111,6 +111,20 @@ static Ecode_t StartTransfer(DmaMode_t                 mode,
                              DMADRV_Callback_t         callback,
                              void                      *cbUserParam);
 
+#if defined(EMDRV_DMADRV_LDMA)
+static Ecode_t StartScatterGather(DmaDirection_t            direction,
+                                  unsigned int              channelId,
+                                  DMADRV_PeripheralSignal_t peripheralSignal,
+                                  void                      *periph,
+                                  const DMADRV_IoVec_t      *iov,
+                                  unsigned int              iovCount,
+                                  LDMA_Descriptor_t         *descPool,
+                                  unsigned int              descPoolCount,
+                                  DMADRV_DataSize_t         size,
+                                  DMADRV_Callback_t         callback,
+                                  void                      *cbUserParam);
+#endif
+
 #if defined(EMDRV_DMADRV_LDMA_S3)
 static void LDMA_IRQHandlerDefault(uint8_t chnum);
 #endif
@@ -575,6 +589,79 @@ Ecode_t DMADRV_MemoryPeripheralPingPong(
                        cbUserParam);
 }
 
+#if defined(EMDRV_DMADRV_LDMA) || defined(DOXYGEN)
+/***************************************************************************//**
+ * @brief
+ *  Start a memory to a peripheral scatter-gather DMA transfer.
+ *
+ * @details
+ *  The fragments are described by a chain of linked LDMA descriptors built
+ *  in @a descPool, so the whole list is sent with a single transfer and a
+ *  single completion interrupt.
+ *
+ * @param[in] channelId
+ *  The channel ID to use for the transfer.
+ *
+ * @param[in] peripheralSignal
+ *  Selects which peripheral/peripheralsignal to use.
+ *
+ * @param[in] dst
+ *  A destination (peripheral register) memory address.
+ *
+ * @param[in] iov
+ *  An array of memory fragments, transferred in order.
+ *
+ * @param[in] iovCount
+ *  A number of entries in @a iov.
+ *
+ * @param[in] descPool
+ *  Caller-provided storage for the linked descriptor chain. Must stay valid
+ *  until the transfer is done. A fragment needs one descriptor per
+ *  DMADRV_MAX_XFER_COUNT items.
+ *
+ * @param[in] descPoolCount
+ *  A number of descriptors in @a descPool.
+ *
+ * @param[in] size
+ *  An item size, byte, halfword or word.
+ *
+ * @param[in] callback
+ *  A function to call when the last fragment has been transferred, use NULL
+ *  if not needed.
+ *
+ * @param[in] cbUserParam
+ *  An optional user parameter to feed to the callback function. Use NULL if
+ *  not needed.
+ *
+ * @return
+ *   @ref ECODE_EMDRV_DMADRV_OK on success. On failure, an appropriate
+ *   DMADRV @ref Ecode_t is returned.
+ ******************************************************************************/
+Ecode_t DMADRV_MemoryPeripheralScatterGather(unsigned int              channelId,
+                                             DMADRV_PeripheralSignal_t peripheralSignal,
+                                             void                      *dst,
+                                             const DMADRV_IoVec_t      *iov,
+                                             unsigned int              iovCount,
+                                             LDMA_Descriptor_t         *descPool,
+                                             unsigned int              descPoolCount,
+                                             DMADRV_DataSize_t         size,
+                                             DMADRV_Callback_t         callback,
+                                             void                      *cbUserParam)
+{
+  return StartScatterGather(dmaDirectionMemToPeripheral,
+                            channelId,
+                            peripheralSignal,
+                            dst,
+                            iov,
+                            iovCount,
+                            descPool,
+                            descPoolCount,
+                            size,
+                            callback,
+                            cbUserParam);
+}
+#endif
+
 /***************************************************************************//**
  * @brief
  *  Start a peripheral to memory DMA transfer.
@@ -704,6 +791,79 @@ Ecode_t DMADRV_PeripheralMemoryPingPong(
                        cbUserParam);
 }
 
+#if defined(EMDRV_DMADRV_LDMA) || defined(DOXYGEN)
+/***************************************************************************//**
+ * @brief
+ *  Start a peripheral to memory scatter-gather DMA transfer.
+ *
+ * @details
+ *  The fragments are described by a chain of linked LDMA descriptors built
+ *  in @a descPool, so the whole list is filled with a single transfer and a
+ *  single completion interrupt.
+ *
+ * @param[in] channelId
+ *  The channel ID to use for the transfer.
+ *
+ * @param[in] peripheralSignal
+ *  Selects which peripheral/peripheralsignal to use.
+ *
+ * @param[in] src
+ *  A source memory (peripheral register) address.
+ *
+ * @param[in] iov
+ *  An array of memory fragments, transferred in order.
+ *
+ * @param[in] iovCount
+ *  A number of entries in @a iov.
+ *
+ * @param[in] descPool
+ *  Caller-provided storage for the linked descriptor chain. Must stay valid
+ *  until the transfer is done. A fragment needs one descriptor per
+ *  DMADRV_MAX_XFER_COUNT items.
+ *
+ * @param[in] descPoolCount
+ *  A number of descriptors in @a descPool.
+ *
+ * @param[in] size
+ *  An item size, byte, halfword or word.
+ *
+ * @param[in] callback
+ *  A function to call when the last fragment has been transferred, use NULL
+ *  if not needed.
+ *
+ * @param[in] cbUserParam
+ *  An optional user parameter to feed to the callback function. Use NULL if
+ *  not needed.
+ *
+ * @return
+ *   @ref ECODE_EMDRV_DMADRV_OK on success. On failure, an appropriate
+ *   DMADRV @ref Ecode_t is returned.
+ ******************************************************************************/
+Ecode_t DMADRV_PeripheralMemoryScatterGather(unsigned int              channelId,
+                                             DMADRV_PeripheralSignal_t peripheralSignal,
+                                             void                      *src,
+                                             const DMADRV_IoVec_t      *iov,
+                                             unsigned int              iovCount,
+                                             LDMA_Descriptor_t         *descPool,
+                                             unsigned int              descPoolCount,
+                                             DMADRV_DataSize_t         size,
+                                             DMADRV_Callback_t         callback,
+                                             void                      *cbUserParam)
+{
+  return StartScatterGather(dmaDirectionPeripheralToMem,
+                            channelId,
+                            peripheralSignal,
+                            src,
+                            iov,
+                            iovCount,
+                            descPool,
+                            descPoolCount,
+                            size,
+                            callback,
+                            cbUserParam);
+}
+#endif
+
 /***************************************************************************//**
  * @brief
  *  Pause an ongoing DMA transfer.
@@ -1598,6 +1758,105 @@ static Ecode_t StartTransfer(DmaMode_t             mode,
 
   return ECODE_EMDRV_DMADRV_OK;
 }
+
+/***************************************************************************//**
+ * @brief
+ *  Build a linked LDMA descriptor chain for a list of memory fragments and
+ *  start it.
+ ******************************************************************************/
+static Ecode_t StartScatterGather(DmaDirection_t            direction,
+                                  unsigned int              channelId,
+                                  DMADRV_PeripheralSignal_t peripheralSignal,
+                                  void                      *periph,
+                                  const DMADRV_IoVec_t      *iov,
+                                  unsigned int              iovCount,
+                                  LDMA_Descriptor_t         *descPool,
+                                  unsigned int              descPoolCount,
+                                  DMADRV_DataSize_t         size,
+                                  DMADRV_Callback_t         callback,
+                                  void                      *cbUserParam)
+{
+  ChTable_t *ch;
+  LDMA_TransferCfg_t xfer;
+  LDMA_Descriptor_t *desc = NULL;
+  unsigned int descCount = 0;
+  unsigned int i;
+
+  if ( !initialized ) {
+    return ECODE_EMDRV_DMADRV_NOT_INITIALIZED;
+  }
+
+  if ( (channelId >= EMDRV_DMADRV_DMA_CH_COUNT)
+       || (periph == NULL)
+       || (iov == NULL)
+       || (iovCount == 0)
+       || (descPool == NULL) ) {
+    return ECODE_EMDRV_DMADRV_PARAM_ERROR;
+  }
+
+  ch = &chTable[channelId];
+  if ( ch->allocated == false ) {
+    return ECODE_EMDRV_DMADRV_CH_NOT_ALLOCATED;
+  }
+
+  for ( i = 0; i < iovCount; i++ ) {
+    uint8_t *buf = (uint8_t *)iov[i].buffer;
+    int left = iov[i].len;
+
+    if ( (buf == NULL) || (left <= 0) ) {
+      return ECODE_EMDRV_DMADRV_PARAM_ERROR;
+    }
+
+    /* Fragments longer than one descriptor can move are split. */
+    while ( left > 0 ) {
+      int count = (left > DMADRV_MAX_XFER_COUNT) ? DMADRV_MAX_XFER_COUNT : left;
+
+      if ( descCount == descPoolCount ) {
+        return ECODE_EMDRV_DMADRV_PARAM_ERROR;
+      }
+
+      if ( desc != NULL ) {
+        desc->xfer.linkMode = ldmaLinkModeAbs;
+        desc->xfer.link     = 1;
+        desc->xfer.linkAddr = LDMA_DESCRIPTOR_LINKABS_ADDR_TO_LINKADDR(&descPool[descCount]);
+      }
+      desc = &descPool[descCount++];
+
+      if ( direction == dmaDirectionMemToPeripheral ) {
+        *desc = m2p;
+        desc->xfer.dstAddr = (uint32_t)(uint8_t *)periph;
+        desc->xfer.srcAddr = (uint32_t)buf;
+      } else {
+        *desc = p2m;
+        desc->xfer.dstAddr = (uint32_t)buf;
+        desc->xfer.srcAddr = (uint32_t)(uint8_t *)periph;
+      }
+      desc->xfer.xferCnt = count - 1;
+      desc->xfer.size    = size;
+      /* Only the last descriptor signals completion. */
+      desc->xfer.doneIfs = 0;
+
+      buf  += (uint32_t)count << size;
+      left -= count;
+    }
+  }
+
+  if ( callback != NULL ) {
+    desc->xfer.doneIfs = 1;
+  }
+
+  xfer = xferCfgPeripheral;
+  xfer.ldmaReqSel = peripheralSignal;
+
+  ch->callback      = callback;
+  ch->userParam     = cbUserParam;
+  ch->callbackCount = 0;
+  ch->mode          = dmaModeBasic;
+
+  LDMA_StartTransfer(channelId, &xfer, &descPool[0]);
+
+  return ECODE_EMDRV_DMADRV_OK;
+}
 #endif /* defined( EMDRV_DMADRV_LDMA ) */
 
 #if defined(EMDRV_DMADRV_LDMA_S3)
@@ -1797,6 +2056,11 @@ static Ecode_t StartTransfer(DmaMode_t             mode,
 ///   @ref DMADRV_PeripheralMemoryPingPong() @n
 ///    Start a DMA ping-pong transfer from a peripheral to memory.
 ///
+///   @ref DMADRV_MemoryPeripheralScatterGather(),
+///   @ref DMADRV_PeripheralMemoryScatterGather() @n
+///    Start a DMA transfer between a peripheral and a list of memory
+///    fragments, using a linked descriptor chain (LDMA only).
+///
 ///   @ref DMADRV_LdmaStartTransfer() @n
 ///    Start a DMA transfer on an LDMA controller.
 ///
@@ -114,6 +114,38 @@ sl_status_t sl_se_deinit(void);
  ******************************************************************************/
 sl_status_t sl_se_set_yield(sl_se_command_context_t *cmd_ctx,
                             bool yield);
+
+#if (SL_SE_MANAGER_ASYNC_QUEUE_SIZE > 0)
+/***************************************************************************//**
+ * @brief
+ *   Advance asynchronous SE command execution.
+ *
+ * @details
+ *   Completes the command running on the SE, if it has finished, calls its
+ *   completion callback and starts the next queued command. Registered as a
+ *   platform process action, so it runs from the main loop whenever
+ *   asynchronous execution is enabled.
+ *   Synchronous SE Manager calls made while an asynchronous command is
+ *   running wait for that command first; its callback is still called from
+ *   here.
+ ******************************************************************************/
+void sl_se_process_action(void);
+
+/***************************************************************************//**
+ * @brief
+ *   Check whether asynchronous SE commands are queued or running.
+ *
+ * @details
+ *   Registered as a power manager sleep hook. The SE completion does not wake
+ *   up the core, so the device stays awake and keeps running
+ *   sl_se_process_action() until the queue has drained.
+ *
+ * @return
+ *   True if no asynchronous SE command is queued, running or waiting for its
+ *   completion callback.
+ ******************************************************************************/
+bool sl_se_async_is_idle(void);
+#endif // SL_SE_MANAGER_ASYNC_QUEUE_SIZE > 0
 #endif // !SL_CATALOG_TZ_SECURE_KEY_LIBRARY_NS_PRESENT
 
 #if defined(SLI_VSE_MAILBOX_COMMAND_SUPPORTED)
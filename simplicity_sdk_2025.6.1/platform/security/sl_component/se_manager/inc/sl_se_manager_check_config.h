@@ -54,6 +54,11 @@
 #error "Yield support is not available on EFR32xG22 devices"
 #endif
 
+#if (SL_SE_MANAGER_ASYNC_QUEUE_SIZE > 0) \
+  && (defined(SL_SE_MANAGER_THREADING) || !defined(SEMAILBOX_PRESENT))
+#error "Asynchronous SE command execution requires bare metal mode and an SE mailbox."
+#endif
+
 #if (SLI_SE_AES_CTR_NUM_BLOCKS_BUFFERED != 1)
 #error "Using multiple blocks for key stream computation is not supported"
 #endif
@@ -98,6 +98,56 @@ sl_status_t sl_se_aes_crypt_ecb(sl_se_command_context_t *cmd_ctx,
                                 const unsigned char *input,
                                 unsigned char *output);
 
+#if (SL_SE_MANAGER_ASYNC_QUEUE_SIZE > 0)
+/***************************************************************************//**
+ * @brief
+ *   Queue an AES-ECB encryption/decryption for asynchronous execution.
+ *
+ * @details
+ *   Same as @ref sl_se_aes_crypt_ecb, except that the function returns as
+ *   soon as the command is queued. The command runs when
+ *   @ref sl_se_process_action is called, which also calls @p callback once
+ *   the output is ready. The command context, key descriptor buffers, input
+ *   and output buffers must stay valid until then.
+ *
+ * @param[in] cmd_ctx
+ *   Pointer to an SE command context object.
+ *
+ * @param[in] key
+ *   Pointer to sl_se_key_descriptor_t structure.
+ *
+ * @param[in] mode
+ *   Crypto operation type (encryption or decryption).
+ *
+ * @param[in] length
+ *   Length of the input data.
+ *
+ * @param[in] input
+ *   Buffer holding the input data.
+ *
+ * @param[out] output
+ *   Buffer holding the output data.
+ *
+ * @param[in] callback
+ *   Called with the command status when the output is ready. May be NULL.
+ *
+ * @param[in] user_data
+ *   Passed to @p callback.
+ *
+ * @return
+ *   Status code, @ref sl_status.h. SL_STATUS_FULL if the asynchronous command
+ *   queue is full.
+ ******************************************************************************/
+sl_status_t sl_se_aes_crypt_ecb_async(sl_se_command_context_t *cmd_ctx,
+                                      const sl_se_key_descriptor_t *key,
+                                      sl_se_cipher_operation_t mode,
+                                      size_t length,
+                                      const unsigned char *input,
+                                      unsigned char *output,
+                                      sl_se_command_callback_t callback,
+                                      void *user_data);
+#endif // SL_SE_MANAGER_ASYNC_QUEUE_SIZE > 0
+
 /***************************************************************************//**
  * @brief
  *   AES-CBC buffer encryption/decryption.
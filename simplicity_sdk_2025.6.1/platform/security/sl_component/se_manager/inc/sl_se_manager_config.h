@@ -55,6 +55,13 @@
   #define SLI_SE_AES_CTR_NUM_BLOCKS_BUFFERED 1
 #endif
 
+// Number of SE commands that can be queued for asynchronous execution, see
+// sl_se_process_action(). 0 disables asynchronous execution. Only available
+// in bare metal mode on devices with an SE mailbox.
+#ifndef SL_SE_MANAGER_ASYNC_QUEUE_SIZE
+  #define SL_SE_MANAGER_ASYNC_QUEUE_SIZE 0
+#endif
+
 // Check consistency of configuration options.
 // Always include se_manager_check_config.h in order to assert that the
 // configuration options dependencies and restrictions are ok.
@@ -103,6 +103,55 @@ sl_status_t sl_se_hash(sl_se_command_context_t *cmd_ctx,
                        uint8_t* digest,
                        size_t digest_len);
 
+#if (SL_SE_MANAGER_ASYNC_QUEUE_SIZE > 0)
+/***************************************************************************//**
+ * @brief
+ *   Queue a one-shot message digest for asynchronous execution.
+ *
+ * @details
+ *   Same as @ref sl_se_hash, except that the function returns as soon as the
+ *   command is queued. The command runs when @ref sl_se_process_action is
+ *   called, which also calls @p callback once the digest is ready. The
+ *   command context, message and digest buffers must stay valid until then.
+ *
+ * @param[in] cmd_ctx
+ *   Pointer to an SE command context object.
+ *
+ * @param[in] hash_type
+ *   Which hashing algorithm to use.
+ *
+ * @param[in] message
+ *   Pointer to the message buffer to compute the hash/digest from.
+ *
+ * @param[in] message_size
+ *   Number of bytes in message.
+ *
+ * @param[out] digest
+ *   Pointer to block of memory to store the final digest.
+ *
+ * @param[in]  digest_len
+ *   The length of the message digest (hash), must be at least the size of the
+ *   corresponding hash type.
+ *
+ * @param[in] callback
+ *   Called with the command status when the digest is ready. May be NULL.
+ *
+ * @param[in] user_data
+ *   Passed to @p callback.
+ *
+ * @return Status code, @ref sl_status.h. SL_STATUS_FULL if the asynchronous
+ *   command queue is full.
+ ******************************************************************************/
+sl_status_t sl_se_hash_async(sl_se_command_context_t *cmd_ctx,
+                             sl_se_hash_type_t hash_type,
+                             const uint8_t *message,
+                             unsigned int message_size,
+                             uint8_t* digest,
+                             size_t digest_len,
+                             sl_se_command_callback_t callback,
+                             void *user_data);
+#endif // SL_SE_MANAGER_ASYNC_QUEUE_SIZE > 0
+
 /***************************************************************************//**
  * @brief
  *   Prepare a SHA1 hash streaming command context object.
@@ -296,6 +345,100 @@ sl_status_t sl_se_hash_multipart_finish(void *hash_type_ctx,
                                         uint8_t *digest_out,
                                         size_t digest_len);
 
+/***************************************************************************//**
+ * @brief
+ *   Prepare a hash streaming batch context.
+ *
+ * @details
+ *   Updates fed through @ref sl_se_hash_multipart_batch_update() are
+ *   accumulated in @p buffer and passed on to
+ *   @ref sl_se_hash_multipart_update() once it is full, so that many small
+ *   updates cost a single SE command. The resulting digest is identical to
+ *   feeding the same data directly to @ref sl_se_hash_multipart_update().
+ *
+ * @param[out] batch_ctx
+ *   Pointer to a hash streaming batch context object.
+ *
+ * @param[in] hash_type_ctx
+ *   Pointer to a hash streaming context object, already prepared by one of
+ *   the hash streaming starts functions.
+ *
+ * @param[in] buffer
+ *   Accumulation buffer. Must stay valid until
+ *   @ref sl_se_hash_multipart_batch_finish() returns.
+ *
+ * @param[in] buffer_size
+ *   Size of @p buffer in bytes. Must be a non-zero multiple of the block
+ *   size of the hash type (64 bytes for SHA-1/SHA-224/SHA-256, 128 bytes for
+ *   SHA-384/SHA-512).
+ *
+ * @return
+ *   Status code, @ref sl_status.h.
+ ******************************************************************************/
+sl_status_t sl_se_hash_multipart_batch_starts(sl_se_hash_batch_context_t *batch_ctx,
+                                              void *hash_type_ctx,
+                                              uint8_t *buffer,
+                                              size_t buffer_size);
+
+/***************************************************************************//**
+ * @brief
+ *   Feeds an input buffer into a batched hash computation.
+ *
+ * @details
+ *   Input is copied into the batch buffer. An SE command is only issued when
+ *   the buffer fills up, or directly on @p input when it is at least a full
+ *   buffer long.
+ *
+ * @param[in] batch_ctx
+ *   Pointer to a hash streaming batch context object.
+ *
+ * @param[in] cmd_ctx
+ *   Pointer to an SE command context object.
+ *
+ * @param[in] input
+ *   Buffer holding the input data, must be at least @p input_len bytes wide.
+ *
+ * @param[in] input_len
+ *   The length of the input data in bytes.
+ *
+ * @return
+ *   Status code, @ref sl_status.h.
+ ******************************************************************************/
+sl_status_t sl_se_hash_multipart_batch_update(sl_se_hash_batch_context_t *batch_ctx,
+                                              sl_se_command_context_t *cmd_ctx,
+                                              const uint8_t *input,
+                                              size_t input_len);
+
+/***************************************************************************//**
+ * @brief
+ *   Finish a batched hash computation and return the resulting hash digest.
+ *
+ * @details
+ *   Feeds the data still held in the batch buffer to the hash streaming
+ *   context, then calls @ref sl_se_hash_multipart_finish().
+ *
+ * @param[in] batch_ctx
+ *   Pointer to a hash streaming batch context object.
+ *
+ * @param[in] cmd_ctx
+ *   Pointer to an SE command context object.
+ *
+ * @param[out] digest_out
+ *   Buffer for holding the message digest (hash), must be at least the size
+ *   of the corresponding message digest type.
+ *
+ * @param[in]  digest_len
+ *   The length of the message digest (hash), must be at least the size of the
+ *   corresponding hash type.
+ *
+ * @return
+ *   Status code, @ref sl_status.h.
+ ******************************************************************************/
+sl_status_t sl_se_hash_multipart_batch_finish(sl_se_hash_batch_context_t *batch_ctx,
+                                              sl_se_command_context_t *cmd_ctx,
+                                              uint8_t *digest_out,
+                                              size_t digest_len);
+
 #ifdef __cplusplus
 }
 #endif
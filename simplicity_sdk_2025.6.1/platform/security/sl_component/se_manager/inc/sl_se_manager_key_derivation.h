@@ -114,6 +114,49 @@ sl_status_t sl_se_ecdh_compute_shared_secret(sl_se_command_context_t *cmd_ctx,
                                              const sl_se_key_descriptor_t *key_in_pub,
                                              const sl_se_key_descriptor_t *key_out);
 
+#if (SL_SE_MANAGER_ASYNC_QUEUE_SIZE > 0)
+/***************************************************************************//**
+ * @brief
+ *   Queue an ECDH shared secret computation for asynchronous execution.
+ *
+ * @details
+ *   Same as @ref sl_se_ecdh_compute_shared_secret, except that the function
+ *   returns as soon as the command is queued. The command runs when
+ *   @ref sl_se_process_action is called, which also calls @p callback once
+ *   the shared secret is ready. The command context and the key descriptor
+ *   buffers must stay valid until then.
+ *
+ * @param[in] cmd_ctx
+ *   Pointer to an SE command context object.
+ *
+ * @param[in] key_in_priv
+ *   Our private key.
+ *
+ * @param[in] key_in_pub
+ *   Their public key.
+ *
+ * @param[out] key_out
+ *   Shared secret key.
+ *
+ * @param[in] callback
+ *   Called with the command status when the shared secret is ready. May be
+ *   NULL.
+ *
+ * @param[in] user_data
+ *   Passed to @p callback.
+ *
+ * @return
+ *   Status code, @ref sl_status.h. SL_STATUS_FULL if the asynchronous command
+ *   queue is full.
+ ******************************************************************************/
+sl_status_t sl_se_ecdh_compute_shared_secret_async(sl_se_command_context_t *cmd_ctx,
+                                                   const sl_se_key_descriptor_t *key_in_priv,
+                                                   const sl_se_key_descriptor_t *key_in_pub,
+                                                   const sl_se_key_descriptor_t *key_out,
+                                                   sl_se_command_callback_t callback,
+                                                   void *user_data);
+#endif // SL_SE_MANAGER_ASYNC_QUEUE_SIZE > 0
+
 // -------------------------------
 // EC J-PAKE
 
@@ -39,6 +39,7 @@
 
 #include "sl_se_manager_defines.h"
 #include "sli_se_manager_mailbox.h"
+#include "sl_status.h"
 #include <stdint.h>
 #include <stdbool.h>
 #include <stddef.h>
@@ -150,6 +151,12 @@ typedef struct sl_se_command_context_t {
                                      ///< register.
 } sl_se_command_context_t;
 
+/// Called from @ref sl_se_process_action when an asynchronous SE command
+/// completes, with the status the synchronous version would have returned.
+typedef void (*sl_se_command_callback_t)(sl_se_command_context_t *cmd_ctx,
+                                         sl_status_t status,
+                                         void *user_data);
+
 /// @} (end addtogroup sl_se_manager_core)
 
 /// @addtogroup sl_se_manager_util
@@ -461,6 +468,15 @@ typedef struct {
 
 #endif
 
+/// Hash streaming batch context. Accumulates small updates in a caller
+/// provided buffer so that they are fed to the SE in one command.
+typedef struct {
+  void     *hash_type_ctx;          ///< Hash streaming context being fed
+  uint8_t  *buffer;                 ///< Accumulation buffer
+  size_t   buffer_size;             ///< Size of buffer in bytes
+  size_t   length;                  ///< Number of bytes held in buffer
+} sl_se_hash_batch_context_t;
+
 /// @} (end addtogroup sl_se_manager_hash)
 
 #if defined(_SILICON_LABS_32B_SERIES_3)
@@ -184,6 +184,42 @@ sl_status_t sli_se_lock_release(void);
 SL_CODE_CLASSIFY(SL_CODE_COMPONENT_SE_MANAGER, SL_CODE_CLASS_TIME_CRITICAL)
 sl_status_t sli_se_execute_and_wait(sl_se_command_context_t *cmd_ctx);
 
+#if (SL_SE_MANAGER_ASYNC_QUEUE_SIZE > 0)
+// Largest number of data transfer descriptors used by an asynchronous command
+// (ECDH: private key auth data and key, output key auth data, public key and
+// output key).
+#define SLI_SE_ASYNC_DATATRANSFERS 5
+
+/// Queued asynchronous SE command. The data transfer descriptors live in the
+/// queue entry so that they stay valid until the SE has processed them.
+typedef struct {
+  sl_se_command_context_t  *cmd_ctx;   ///< Command to execute
+  sl_se_command_callback_t callback;   ///< Completion callback
+  void                     *user_data; ///< Passed to the callback
+  uint8_t                  retries;    ///< Extra attempts on SL_STATUS_FAIL
+  sli_se_datatransfer_t    data[SLI_SE_ASYNC_DATATRANSFERS]; ///< Descriptor storage
+} sli_se_async_command_t;
+
+/***************************************************************************//**
+ * @brief
+ *   Get the next free asynchronous command queue entry.
+ *
+ * @details
+ *   The caller builds the command, using the entry's descriptor storage for
+ *   its data transfers, and then queues it with @ref sli_se_async_submit.
+ *
+ * @return
+ *   Pointer to the entry, or NULL if the queue is full.
+ ******************************************************************************/
+sli_se_async_command_t *sli_se_async_alloc(void);
+
+/***************************************************************************//**
+ * @brief
+ *   Queue the entry returned by the last call to @ref sli_se_async_alloc.
+ ******************************************************************************/
+void sli_se_async_submit(void);
+#endif // SL_SE_MANAGER_ASYNC_QUEUE_SIZE > 0
+
 #if defined(SLI_MAILBOX_COMMAND_SUPPORTED)
 // Key handling helper functions
 sl_status_t sli_key_get_storage_size(const sl_se_key_descriptor_t* key,
@@ -113,6 +113,18 @@ static volatile sli_se_mailbox_response_t se_manager_command_response = SLI_SE_R
 #endif // #if defined (SL_SE_MANAGER_THREADING)
 //   || defined(SL_SE_MANAGER_YIELD_WHILE_WAITING_FOR_COMMAND_COMPLETION)
 
+#if (SL_SE_MANAGER_ASYNC_QUEUE_SIZE > 0)
+// Asynchronous command queue. The entry at se_async_head is the oldest one;
+// it is running on the SE when se_async_running is set, and has completed
+// with se_async_status when se_async_completed is set.
+static sli_se_async_command_t se_async_queue[SL_SE_MANAGER_ASYNC_QUEUE_SIZE];
+static uint8_t se_async_head = 0;
+static uint8_t se_async_count = 0;
+static bool se_async_running = false;
+static bool se_async_completed = false;
+static sl_status_t se_async_status = SL_STATUS_FAIL;
+#endif // SL_SE_MANAGER_ASYNC_QUEUE_SIZE > 0
+
 // -----------------------------------------------------------------------------
 // Global functions
 
@@ -370,6 +382,94 @@ sl_status_t sl_se_set_yield(sl_se_command_context_t *cmd_ctx,
  *   - @c SL_STATUS_INVALID_PARAMETER
  ******************************************************************************/
 #if defined(SLI_MAILBOX_COMMAND_SUPPORTED) && !defined(SLI_SE_MANAGER_HOST_SYSTEM)
+
+#if (SL_SE_MANAGER_ASYNC_QUEUE_SIZE > 0)
+
+/***************************************************************************//**
+ * Collect the response of the running asynchronous command. Waits for the
+ * command if it has not completed yet.
+ ******************************************************************************/
+static void se_async_complete(void)
+{
+  sli_se_mailbox_response_t command_response = sli_se_mailbox_handle_response();
+  sl_status_t status = sli_se_lock_release();
+
+  se_async_status = (command_response == SLI_SE_RESPONSE_OK)
+                    ? status
+                    : sli_se_to_sl_status(command_response);
+  se_async_running = false;
+  se_async_completed = true;
+}
+
+/***************************************************************************//**
+ * Get the next free asynchronous command queue entry.
+ ******************************************************************************/
+sli_se_async_command_t *sli_se_async_alloc(void)
+{
+  if (se_async_count >= SL_SE_MANAGER_ASYNC_QUEUE_SIZE) {
+    return NULL;
+  }
+  return &se_async_queue[(se_async_head + se_async_count)
+                         % SL_SE_MANAGER_ASYNC_QUEUE_SIZE];
+}
+
+/***************************************************************************//**
+ * Queue the entry returned by the last call to sli_se_async_alloc().
+ ******************************************************************************/
+void sli_se_async_submit(void)
+{
+  EFM_ASSERT(se_async_count < SL_SE_MANAGER_ASYNC_QUEUE_SIZE);
+  se_async_count++;
+}
+
+/***************************************************************************//**
+ * Advance asynchronous SE command execution.
+ ******************************************************************************/
+void sl_se_process_action(void)
+{
+  sli_se_async_command_t *entry;
+
+  if (se_async_running
+      && (SEMAILBOX_HOST->RX_STATUS & SEMAILBOX_RX_STATUS_RXINT)) {
+    se_async_complete();
+  }
+
+  if (se_async_completed && se_async_status == SL_STATUS_FAIL
+      && se_async_queue[se_async_head].retries > 0) {
+    // Run the command again, the same way the synchronous version retries.
+    se_async_queue[se_async_head].retries--;
+    se_async_completed = false;
+  }
+
+  if (se_async_completed) {
+    entry = &se_async_queue[se_async_head];
+    se_async_head = (se_async_head + 1) % SL_SE_MANAGER_ASYNC_QUEUE_SIZE;
+    se_async_count--;
+    se_async_completed = false;
+    if (entry->callback != NULL) {
+      entry->callback(entry->cmd_ctx, se_async_status, entry->user_data);
+    }
+  }
+
+  if (!se_async_running && !se_async_completed && se_async_count > 0) {
+    entry = &se_async_queue[se_async_head];
+    if (sli_se_lock_acquire() == SL_STATUS_OK) {
+      sli_se_mailbox_execute_command(&entry->cmd_ctx->command);
+      se_async_running = true;
+    }
+  }
+}
+
+/***************************************************************************//**
+ * Check whether asynchronous SE commands are queued or running.
+ ******************************************************************************/
+bool sl_se_async_is_idle(void)
+{
+  return se_async_count == 0;
+}
+
+#endif // SL_SE_MANAGER_ASYNC_QUEUE_SIZE > 0
+
 sl_status_t sli_se_execute_and_wait(sl_se_command_context_t *cmd_ctx)
 {
   sl_status_t status = SL_STATUS_FAIL;
@@ -379,6 +479,14 @@ sl_status_t sli_se_execute_and_wait(sl_se_command_context_t *cmd_ctx)
     return SL_STATUS_INVALID_PARAMETER;
   }
 
+  #if (SL_SE_MANAGER_ASYNC_QUEUE_SIZE > 0)
+  // The mailbox runs one command at a time. Let a running asynchronous
+  // command finish; its callback is left to sl_se_process_action().
+  if (se_async_running) {
+    se_async_complete();
+  }
+  #endif
+
   // Try to acquire SE lock
   status = sli_se_lock_acquire();
   if (status != SL_STATUS_OK) {
@@ -55,14 +55,16 @@ uint32_t memcmp_time_cst(uint8_t *in1, uint8_t *in2, uint32_t size)
 // Global Functions
 
 /***************************************************************************//**
- * AES-ECB block encryption/decryption.
+ * Build an AES-ECB command. data must hold four descriptors and stay valid
+ * until the command has been executed.
  ******************************************************************************/
-sl_status_t sl_se_aes_crypt_ecb(sl_se_command_context_t *cmd_ctx,
-                                const sl_se_key_descriptor_t *key,
-                                sl_se_cipher_operation_t mode,
-                                size_t length,
-                                const unsigned char *input,
-                                unsigned char *output)
+static sl_status_t aes_ecb_command(sl_se_command_context_t *cmd_ctx,
+                                   const sl_se_key_descriptor_t *key,
+                                   sl_se_cipher_operation_t mode,
+                                   size_t length,
+                                   const unsigned char *input,
+                                   unsigned char *output,
+                                   sli_se_datatransfer_t *data)
 {
   if (cmd_ctx == NULL || key == NULL || input == NULL || output == NULL
       || (length & 0xFU) != 0U) {
@@ -84,19 +86,83 @@ sl_status_t sl_se_aes_crypt_ecb(sl_se_command_context_t *cmd_ctx,
   sli_se_mailbox_command_add_parameter(se_cmd, length);
 
   // Add key metadata block to command
-  sli_add_key_metadata(cmd_ctx, key, status);
+  status = sli_se_get_auth_buffer(key, &data[0]);
+  if (status != SL_STATUS_OK) {
+    return status;
+  }
+  sli_se_mailbox_command_add_input(se_cmd, &data[0]);
   // Add key input block to command
-  sli_add_key_input(cmd_ctx, key, status);
+  status = sli_se_get_key_input_output(key, &data[1]);
+  if (status != SL_STATUS_OK) {
+    return status;
+  }
+  sli_se_mailbox_command_add_input(se_cmd, &data[1]);
 
-  sli_se_datatransfer_t in = SLI_SE_DATATRANSFER_DEFAULT(input, length);
-  sli_se_mailbox_command_add_input(se_cmd, &in);
+  data[2] = (sli_se_datatransfer_t)SLI_SE_DATATRANSFER_DEFAULT(input, length);
+  sli_se_mailbox_command_add_input(se_cmd, &data[2]);
 
-  sli_se_datatransfer_t out = SLI_SE_DATATRANSFER_DEFAULT(output, length);
-  sli_se_mailbox_command_add_output(se_cmd, &out);
+  data[3] = (sli_se_datatransfer_t)SLI_SE_DATATRANSFER_DEFAULT(output, length);
+  sli_se_mailbox_command_add_output(se_cmd, &data[3]);
+
+  return SL_STATUS_OK;
+}
+
+/***************************************************************************//**
+ * AES-ECB block encryption/decryption.
+ ******************************************************************************/
+sl_status_t sl_se_aes_crypt_ecb(sl_se_command_context_t *cmd_ctx,
+                                const sl_se_key_descriptor_t *key,
+                                sl_se_cipher_operation_t mode,
+                                size_t length,
+                                const unsigned char *input,
+                                unsigned char *output)
+{
+  sli_se_datatransfer_t data[4];
+  sl_status_t status;
+
+  status = aes_ecb_command(cmd_ctx, key, mode, length, input, output, data);
+  if (status != SL_STATUS_OK) {
+    return status;
+  }
 
   return sli_se_execute_and_wait(cmd_ctx);
 }
 
+#if (SL_SE_MANAGER_ASYNC_QUEUE_SIZE > 0) && !defined(SLI_SE_MANAGER_HOST_SYSTEM)
+/***************************************************************************//**
+ * Queue an AES-ECB encryption/decryption for asynchronous execution.
+ ******************************************************************************/
+sl_status_t sl_se_aes_crypt_ecb_async(sl_se_command_context_t *cmd_ctx,
+                                      const sl_se_key_descriptor_t *key,
+                                      sl_se_cipher_operation_t mode,
+                                      size_t length,
+                                      const unsigned char *input,
+                                      unsigned char *output,
+                                      sl_se_command_callback_t callback,
+                                      void *user_data)
+{
+  sli_se_async_command_t *entry = sli_se_async_alloc();
+  sl_status_t status;
+
+  if (entry == NULL) {
+    return SL_STATUS_FULL;
+  }
+
+  status = aes_ecb_command(cmd_ctx, key, mode, length, input, output, entry->data);
+  if (status != SL_STATUS_OK) {
+    return status;
+  }
+
+  entry->cmd_ctx = cmd_ctx;
+  entry->callback = callback;
+  entry->user_data = user_data;
+  entry->retries = 0;
+
+  sli_se_async_submit();
+  return SL_STATUS_OK;
+}
+#endif // SL_SE_MANAGER_ASYNC_QUEUE_SIZE > 0 && !SLI_SE_MANAGER_HOST_SYSTEM
+
 /***************************************************************************//**
  * AES-CBC buffer encryption/decryption.
  ******************************************************************************/
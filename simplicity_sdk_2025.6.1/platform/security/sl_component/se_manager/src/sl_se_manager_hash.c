@@ -603,53 +603,201 @@ sl_status_t sl_se_hash_multipart_finish(void *hash_type_ctx,
 }
 
 /***************************************************************************//**
- *   Produce a message digest (a hash block) using the input data.
+ *   Prepare a hash streaming batch context.
  ******************************************************************************/
-sl_status_t sl_se_hash(sl_se_command_context_t *cmd_ctx,
-                       sl_se_hash_type_t hash_type,
-                       const uint8_t *message,
-                       unsigned int message_size,
-                       uint8_t* digest,
-                       size_t digest_len)
+sl_status_t sl_se_hash_multipart_batch_starts(sl_se_hash_batch_context_t *batch_ctx,
+                                              void *hash_type_ctx,
+                                              uint8_t *buffer,
+                                              size_t buffer_size)
 {
-  if (cmd_ctx == NULL
-      || digest == NULL
-      || (message == NULL
-          && message_size != 0)) {
+  size_t blocksize;
+
+  if (batch_ctx == NULL || hash_type_ctx == NULL || buffer == NULL) {
     return SL_STATUS_INVALID_PARAMETER;
   }
 
-  sli_se_mailbox_command_t *se_cmd = &cmd_ctx->command;
-  uint32_t command_word = SLI_SE_COMMAND_HASH;
-  uint32_t digest_size = 0;
+  switch (((sl_se_sha1_multipart_context_t*)hash_type_ctx)->hash_type) {
+    case SL_SE_HASH_SHA1:
+    case SL_SE_HASH_SHA224:
+    case SL_SE_HASH_SHA256:
+      blocksize = 64;
+      break;
+
+#if (_SILICON_LABS_SECURITY_FEATURE == _SILICON_LABS_SECURITY_FEATURE_VAULT)
+    case SL_SE_HASH_SHA384:
+    case SL_SE_HASH_SHA512:
+      blocksize = 128;
+      break;
+#endif
+
+    default:
+      return SL_STATUS_INVALID_PARAMETER;
+  }
+
+  // Flushing whole blocks keeps the hash context block aligned, so each
+  // flush is a single SE command without a copy through its block buffer.
+  if (buffer_size == 0 || (buffer_size & (blocksize - 1)) != 0) {
+    return SL_STATUS_INVALID_PARAMETER;
+  }
+
+  batch_ctx->hash_type_ctx = hash_type_ctx;
+  batch_ctx->buffer = buffer;
+  batch_ctx->buffer_size = buffer_size;
+  batch_ctx->length = 0;
+
+  return SL_STATUS_OK;
+}
+
+/***************************************************************************//**
+ *   Feeds an input buffer into a batched hash computation.
+ ******************************************************************************/
+sl_status_t sl_se_hash_multipart_batch_update(sl_se_hash_batch_context_t *batch_ctx,
+                                              sl_se_command_context_t *cmd_ctx,
+                                              const uint8_t *input,
+                                              size_t input_len)
+{
+  sl_status_t status;
+  size_t n;
+
+  if ( input_len == 0 ) {
+    return SL_STATUS_OK;
+  }
+
+  if (batch_ctx == NULL || cmd_ctx == NULL || input == NULL) {
+    return SL_STATUS_INVALID_PARAMETER;
+  }
+
+  if ( batch_ctx->length > 0 ) {
+    n = batch_ctx->buffer_size - batch_ctx->length;
+    if ( n > input_len ) {
+      n = input_len;
+    }
+    memcpy(batch_ctx->buffer + batch_ctx->length, input, n);
+    batch_ctx->length += n;
+    input += n;
+    input_len -= n;
+
+    if ( batch_ctx->length < batch_ctx->buffer_size ) {
+      return SL_STATUS_OK;
+    }
+
+    status = sl_se_hash_multipart_update(batch_ctx->hash_type_ctx, cmd_ctx,
+                                         batch_ctx->buffer, batch_ctx->length);
+    if (status != SL_STATUS_OK) {
+      return status;
+    }
+    batch_ctx->length = 0;
+  }
+
+  // Input spanning whole buffers goes to the SE without being copied.
+  if ( input_len >= batch_ctx->buffer_size ) {
+    n = input_len - (input_len % batch_ctx->buffer_size);
+    status = sl_se_hash_multipart_update(batch_ctx->hash_type_ctx, cmd_ctx,
+                                         input, n);
+    if (status != SL_STATUS_OK) {
+      return status;
+    }
+    input += n;
+    input_len -= n;
+  }
+
+  if ( input_len > 0 ) {
+    memcpy(batch_ctx->buffer, input, input_len);
+    batch_ctx->length = input_len;
+  }
+
+  return SL_STATUS_OK;
+}
+
+/***************************************************************************//**
+ *   Finish a batched hash computation.
+ ******************************************************************************/
+sl_status_t sl_se_hash_multipart_batch_finish(sl_se_hash_batch_context_t *batch_ctx,
+                                              sl_se_command_context_t *cmd_ctx,
+                                              uint8_t *digest_out,
+                                              size_t digest_len)
+{
+  sl_status_t status;
+
+  if (batch_ctx == NULL || cmd_ctx == NULL) {
+    return SL_STATUS_INVALID_PARAMETER;
+  }
+
+  status = sl_se_hash_multipart_update(batch_ctx->hash_type_ctx, cmd_ctx,
+                                       batch_ctx->buffer, batch_ctx->length);
+  if (status != SL_STATUS_OK) {
+    return status;
+  }
+  batch_ctx->length = 0;
+
+  return sl_se_hash_multipart_finish(batch_ctx->hash_type_ctx, cmd_ctx,
+                                     digest_out, digest_len);
+}
+
+/***************************************************************************//**
+ *   Get the command word and digest size of a one-shot hash.
+ ******************************************************************************/
+static sl_status_t hash_command_word(sl_se_hash_type_t hash_type,
+                                     uint32_t *command_word,
+                                     uint32_t *digest_size)
+{
+  *command_word = SLI_SE_COMMAND_HASH;
 
   switch (hash_type) {
     case SL_SE_HASH_SHA1:
-      command_word |= SLI_SE_COMMAND_OPTION_HASH_SHA1;
-      digest_size = 20;
+      *command_word |= SLI_SE_COMMAND_OPTION_HASH_SHA1;
+      *digest_size = 20;
       break;
     case SL_SE_HASH_SHA224:
-      command_word |= SLI_SE_COMMAND_OPTION_HASH_SHA224;
-      digest_size = 28;
+      *command_word |= SLI_SE_COMMAND_OPTION_HASH_SHA224;
+      *digest_size = 28;
       break;
     case SL_SE_HASH_SHA256:
-      command_word |= SLI_SE_COMMAND_OPTION_HASH_SHA256;
-      digest_size = 32;
+      *command_word |= SLI_SE_COMMAND_OPTION_HASH_SHA256;
+      *digest_size = 32;
       break;
 #if (_SILICON_LABS_SECURITY_FEATURE == _SILICON_LABS_SECURITY_FEATURE_VAULT)
     case SL_SE_HASH_SHA384:
-      command_word |= SLI_SE_COMMAND_OPTION_HASH_SHA384;
-      digest_size = 48;
+      *command_word |= SLI_SE_COMMAND_OPTION_HASH_SHA384;
+      *digest_size = 48;
       break;
     case SL_SE_HASH_SHA512:
-      digest_size = 64;
-      command_word |= SLI_SE_COMMAND_OPTION_HASH_SHA512;
+      *digest_size = 64;
+      *command_word |= SLI_SE_COMMAND_OPTION_HASH_SHA512;
       break;
 #endif
     default:
       return SL_STATUS_INVALID_PARAMETER;
   }
 
+  return SL_STATUS_OK;
+}
+
+/***************************************************************************//**
+ *   Produce a message digest (a hash block) using the input data.
+ ******************************************************************************/
+sl_status_t sl_se_hash(sl_se_command_context_t *cmd_ctx,
+                       sl_se_hash_type_t hash_type,
+                       const uint8_t *message,
+                       unsigned int message_size,
+                       uint8_t* digest,
+                       size_t digest_len)
+{
+  if (cmd_ctx == NULL
+      || digest == NULL
+      || (message == NULL
+          && message_size != 0)) {
+    return SL_STATUS_INVALID_PARAMETER;
+  }
+
+  sli_se_mailbox_command_t *se_cmd = &cmd_ctx->command;
+  uint32_t command_word;
+  uint32_t digest_size = 0;
+
+  if (hash_command_word(hash_type, &command_word, &digest_size) != SL_STATUS_OK) {
+    return SL_STATUS_INVALID_PARAMETER;
+  }
+
   if ( digest_len < digest_size ) {
     return SL_STATUS_INVALID_PARAMETER;
   }
@@ -668,6 +816,63 @@ sl_status_t sl_se_hash(sl_se_command_context_t *cmd_ctx,
   return sli_se_execute_and_wait(cmd_ctx);
 }
 
+#if (SL_SE_MANAGER_ASYNC_QUEUE_SIZE > 0) && !defined(SLI_SE_MANAGER_HOST_SYSTEM)
+/***************************************************************************//**
+ *   Queue a one-shot hash for asynchronous execution.
+ ******************************************************************************/
+sl_status_t sl_se_hash_async(sl_se_command_context_t *cmd_ctx,
+                             sl_se_hash_type_t hash_type,
+                             const uint8_t *message,
+                             unsigned int message_size,
+                             uint8_t* digest,
+                             size_t digest_len,
+                             sl_se_command_callback_t callback,
+                             void *user_data)
+{
+  if (cmd_ctx == NULL
+      || digest == NULL
+      || (message == NULL
+          && message_size != 0)) {
+    return SL_STATUS_INVALID_PARAMETER;
+  }
+
+  sli_se_mailbox_command_t *se_cmd = &cmd_ctx->command;
+  sli_se_async_command_t *entry;
+  uint32_t command_word;
+  uint32_t digest_size = 0;
+
+  if (hash_command_word(hash_type, &command_word, &digest_size) != SL_STATUS_OK) {
+    return SL_STATUS_INVALID_PARAMETER;
+  }
+
+  if ( digest_len < digest_size ) {
+    return SL_STATUS_INVALID_PARAMETER;
+  }
+
+  entry = sli_se_async_alloc();
+  if (entry == NULL) {
+    return SL_STATUS_FULL;
+  }
+
+  sli_se_command_init(cmd_ctx, command_word);
+
+  sli_se_mailbox_command_add_parameter(se_cmd, message_size);
+
+  entry->cmd_ctx = cmd_ctx;
+  entry->callback = callback;
+  entry->user_data = user_data;
+  entry->retries = 0;
+  entry->data[0] = (sli_se_datatransfer_t)SLI_SE_DATATRANSFER_DEFAULT(message, message_size);
+  entry->data[1] = (sli_se_datatransfer_t)SLI_SE_DATATRANSFER_DEFAULT(digest, digest_size);
+
+  sli_se_mailbox_command_add_input(se_cmd, &entry->data[0]);
+  sli_se_mailbox_command_add_output(se_cmd, &entry->data[1]);
+
+  sli_se_async_submit();
+  return SL_STATUS_OK;
+}
+#endif // SL_SE_MANAGER_ASYNC_QUEUE_SIZE > 0 && !SLI_SE_MANAGER_HOST_SYSTEM
+
 /** @} (end addtogroup sl_se) */
 
 #endif // defined(SLI_MAILBOX_COMMAND_SUPPORTED)
@@ -65,19 +65,20 @@ static const char * const ecjpake_id[] = {
 // Elliptic-curve Diffie–Hellman
 
 /***************************************************************************//**
- * ECDH shared secret computation.
+ * Build an ECDH shared secret command. data must hold five descriptors and
+ * stay valid until the command has been executed.
  ******************************************************************************/
-sl_status_t sl_se_ecdh_compute_shared_secret(sl_se_command_context_t *cmd_ctx,
-                                             const sl_se_key_descriptor_t *key_in_priv,
-                                             const sl_se_key_descriptor_t *key_in_pub,
-                                             const sl_se_key_descriptor_t *key_out)
+static sl_status_t ecdh_command(sl_se_command_context_t *cmd_ctx,
+                                const sl_se_key_descriptor_t *key_in_priv,
+                                const sl_se_key_descriptor_t *key_in_pub,
+                                const sl_se_key_descriptor_t *key_out,
+                                sli_se_datatransfer_t *data)
 {
   sl_status_t status;
   uint32_t keyspec_out;
   uint32_t keyspec_in;
   uint32_t key_pubkey_size;
-  sli_se_datatransfer_t pubkey_input_buffer;
-  sli_se_datatransfer_t auth_buffer_out;
+  sli_se_datatransfer_t *pubkey_input_buffer = &data[3];
 
   if (cmd_ctx == NULL
       || key_in_priv == NULL || key_in_pub == NULL || key_out == NULL) {
@@ -142,20 +143,28 @@ sl_status_t sl_se_ecdh_compute_shared_secret(sl_se_command_context_t *cmd_ctx,
   sli_se_mailbox_command_add_parameter(&cmd_ctx->command, keyspec_out);
 
   // Add key input metadata block to command
-  sli_add_key_metadata(cmd_ctx, key_in_priv, status);
+  status = sli_se_get_auth_buffer(key_in_priv, &data[0]);
+  if (status != SL_STATUS_OK) {
+    return status;
+  }
+  sli_se_mailbox_command_add_input(&cmd_ctx->command, &data[0]);
   // Add key input block to command
-  sli_add_key_input(cmd_ctx, key_in_priv, status);
+  status = sli_se_get_key_input_output(key_in_priv, &data[1]);
+  if (status != SL_STATUS_OK) {
+    return status;
+  }
+  sli_se_mailbox_command_add_input(&cmd_ctx->command, &data[1]);
 
   if (key_out->storage.method != SL_SE_KEY_STORAGE_EXTERNAL_PLAINTEXT) {
     // Add key output metadata block to command
-    status = sli_se_get_auth_buffer(key_out, &auth_buffer_out);
+    status = sli_se_get_auth_buffer(key_out, &data[2]);
     if (status != SL_STATUS_OK) {
       return status;
     }
-    sli_se_mailbox_command_add_input(&cmd_ctx->command, &auth_buffer_out);
+    sli_se_mailbox_command_add_input(&cmd_ctx->command, &data[2]);
   }
   // Add key of other party
-  status = sli_se_get_key_input_output(key_in_pub, &pubkey_input_buffer);
+  status = sli_se_get_key_input_output(key_in_pub, pubkey_input_buffer);
   if (status != SL_STATUS_OK) {
     return status;
   }
@@ -166,8 +175,8 @@ sl_status_t sl_se_ecdh_compute_shared_secret(sl_se_command_context_t *cmd_ctx,
       // If using custom domain, the key buffer stores domain parameters,
       // however when computing the shared secret only the key is of interest.
       uint32_t domain_size = ((sl_se_custom_weierstrass_prime_domain_t*)key_in_pub->domain)->size;
-      pubkey_input_buffer.data = &key_in_pub->storage.location.buffer.pointer[domain_size * 6];
-      pubkey_input_buffer.length = (domain_size * 2) | SLI_SE_DATATRANSFER_REALIGN;
+      pubkey_input_buffer->data = &key_in_pub->storage.location.buffer.pointer[domain_size * 6];
+      pubkey_input_buffer->length = (domain_size * 2) | SLI_SE_DATATRANSFER_REALIGN;
     } else {
       // Does not contain a public key.
       return SL_STATUS_INVALID_KEY;
@@ -175,10 +184,33 @@ sl_status_t sl_se_ecdh_compute_shared_secret(sl_se_command_context_t *cmd_ctx,
   }
   #endif
 
-  sli_se_mailbox_command_add_input(&cmd_ctx->command, &pubkey_input_buffer);
+  sli_se_mailbox_command_add_input(&cmd_ctx->command, pubkey_input_buffer);
 
   // Add key output block to command
-  sli_add_key_output(cmd_ctx, key_out, status);
+  status = sli_se_get_key_input_output(key_out, &data[4]);
+  if (status != SL_STATUS_OK) {
+    return status;
+  }
+  sli_se_mailbox_command_add_output(&cmd_ctx->command, &data[4]);
+
+  return SL_STATUS_OK;
+}
+
+/***************************************************************************//**
+ * ECDH shared secret computation.
+ ******************************************************************************/
+sl_status_t sl_se_ecdh_compute_shared_secret(sl_se_command_context_t *cmd_ctx,
+                                             const sl_se_key_descriptor_t *key_in_priv,
+                                             const sl_se_key_descriptor_t *key_in_pub,
+                                             const sl_se_key_descriptor_t *key_out)
+{
+  sli_se_datatransfer_t data[5];
+  sl_status_t status;
+
+  status = ecdh_command(cmd_ctx, key_in_priv, key_in_pub, key_out, data);
+  if (status != SL_STATUS_OK) {
+    return status;
+  }
 
   // Execute command.
   // The retries are necessary in order to reduce the risk of random failures
@@ -193,6 +225,40 @@ sl_status_t sl_se_ecdh_compute_shared_secret(sl_se_command_context_t *cmd_ctx,
   return status;
 }
 
+#if (SL_SE_MANAGER_ASYNC_QUEUE_SIZE > 0) && !defined(SLI_SE_MANAGER_HOST_SYSTEM)
+/***************************************************************************//**
+ * Queue an ECDH shared secret computation for asynchronous execution.
+ ******************************************************************************/
+sl_status_t sl_se_ecdh_compute_shared_secret_async(sl_se_command_context_t *cmd_ctx,
+                                                   const sl_se_key_descriptor_t *key_in_priv,
+                                                   const sl_se_key_descriptor_t *key_in_pub,
+                                                   const sl_se_key_descriptor_t *key_out,
+                                                   sl_se_command_callback_t callback,
+                                                   void *user_data)
+{
+  sli_se_async_command_t *entry = sli_se_async_alloc();
+  sl_status_t status;
+
+  if (entry == NULL) {
+    return SL_STATUS_FULL;
+  }
+
+  status = ecdh_command(cmd_ctx, key_in_priv, key_in_pub, key_out, entry->data);
+  if (status != SL_STATUS_OK) {
+    return status;
+  }
+
+  entry->cmd_ctx = cmd_ctx;
+  entry->callback = callback;
+  entry->user_data = user_data;
+  // Same retries as the synchronous version, see above.
+  entry->retries = SLI_SE_MAX_POINT_MULT_RETRIES - 1U;
+
+  sli_se_async_submit();
+  return SL_STATUS_OK;
+}
+#endif // SL_SE_MANAGER_ASYNC_QUEUE_SIZE > 0 && !SLI_SE_MANAGER_HOST_SYSTEM
+
 // -------------------------------
 // ECJPAKE
 
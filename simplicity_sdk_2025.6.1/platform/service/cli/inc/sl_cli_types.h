@@ -68,6 +68,10 @@ extern "C" {
 #define SL_CLI_ACTIVE_FLAG_EN   1
 #endif
 
+#ifndef SL_CLI_COMMAND_INDEX_SIZE
+#define SL_CLI_COMMAND_INDEX_SIZE   0     ///< Number of command lookup index slots, 0 to disable
+#endif
+
 #define SL_CLI_NVM3_KEY_COUNT    (0x100)                                                             ///< sl cli nvm3 key count
 #define SL_CLI_NVM3_KEY_BEGIN    (0x3000)                                                            ///< sl cli nvm3 key begin
 #define SL_CLI_NVM3_KEY_END      (SL_CLI_NVM3_KEY_BEGIN + SL_CLI_NVM3_KEY_COUNT)                     ///< sl cli nvm3 key end
@@ -134,6 +138,16 @@ typedef struct {
   const sl_cli_command_entry_t *command_table;  ///< Command table pointer.
 } sl_cli_command_group_t;
 
+#if SL_CLI_COMMAND_INDEX_SIZE
+/// @brief Struct representing a slot in the command lookup index.
+/// A slot maps a name within a command table to its entry. Root level
+/// entries, which are shared by all command groups, use a NULL table.
+typedef struct {
+  const sl_cli_command_entry_t *table;          ///< Table owning the entry, NULL for the root level.
+  const sl_cli_command_entry_t *entry;          ///< Command table entry, NULL for an empty slot.
+} sl_cli_command_index_slot_t;
+#endif
+
 // Distinguishing different input types
 typedef uint8_t sl_cli_input_type_t;               ///< sl cli input type t
 
@@ -156,6 +170,10 @@ typedef struct sl_cli {
   size_t history_pos;                          ///< Position in history, if enabled.
 #endif
   sl_iostream_t  *iostream_handle;             ///< The iostream used by the CLI.
+#if SL_CLI_COMMAND_INDEX_SIZE
+  sl_cli_command_index_slot_t command_index[SL_CLI_COMMAND_INDEX_SIZE]; ///< Command lookup index.
+  uint8_t command_index_state;                 ///< State of the command lookup index.
+#endif
 #if defined(SL_CLI_ACTIVE_FLAG_EN)
   bool active;                                 ///< A boolean indicating that the CLI is processing input.
 #endif
@@ -48,6 +48,17 @@
 #define SL_CLI_EOL_STRING "\n"
 #endif
 
+#if SL_CLI_COMMAND_INDEX_SIZE
+#if (SL_CLI_COMMAND_INDEX_SIZE & (SL_CLI_COMMAND_INDEX_SIZE - 1)) != 0
+  #error "SL_CLI_COMMAND_INDEX_SIZE must be zero or a power of two"
+#endif
+
+// States of the command lookup index
+#define SLI_CLI_COMMAND_INDEX_STALE     (0U)   ///< Index must be rebuilt before use
+#define SLI_CLI_COMMAND_INDEX_READY     (1U)   ///< Index reflects the command groups
+#define SLI_CLI_COMMAND_INDEX_UNUSABLE  (2U)   ///< Index too small, tables are searched linearly
+#endif
+
 /***************************************************************************//**
  * @brief
  *   Hook executed before the command. Unless specifically redefined to
@@ -317,6 +328,9 @@ bool sl_cli_command_add_command_group(sl_cli_handle_t handle, sl_cli_command_gro
   if ((command_group != NULL) && (!command_group->in_use)) {
     command_group->in_use = true;
     sl_slist_push(&handle->command_group, &command_group->node);
+#if SL_CLI_COMMAND_INDEX_SIZE
+    handle->command_index_state = SLI_CLI_COMMAND_INDEX_STALE;
+#endif
     status = true;
   }
   return status;
@@ -330,6 +344,9 @@ bool sl_cli_command_remove_command_group(sl_cli_handle_t handle, sl_cli_command_
     command_group->in_use = false;
     sl_slist_remove(&handle->command_group, &command_group->node);
     command_group->node.node = NULL;
+#if SL_CLI_COMMAND_INDEX_SIZE
+    handle->command_index_state = SLI_CLI_COMMAND_INDEX_STALE;
+#endif
     status = true;
   }
   return status;
@@ -337,6 +354,37 @@ bool sl_cli_command_remove_command_group(sl_cli_handle_t handle, sl_cli_command_
 
 // The following function is only needed if advanced input handling is enabled
 #if !defined(SL_CLI_DUT) && (SL_CLI_ADVANCED_INPUT_HANDLING == 1)
+/***************************************************************************//**
+ * @brief
+ *   Append a string to the possible matches, keeping track of the length so
+ *   that the matches do not have to be rescanned for every appended name.
+ *
+ * @param[in, out] matches      The possible matches string.
+ *
+ * @param[in] matches_size      The size of the possible matches buffer.
+ *
+ * @param[in, out] matches_len  The current length of the possible matches.
+ *
+ * @param[in] string            The string to append.
+ ******************************************************************************/
+static void append_match(char *matches,
+                         size_t matches_size,
+                         size_t *matches_len,
+                         const char *string)
+{
+  size_t len = strlen(string);
+
+  if (*matches_len + 1 >= matches_size) {
+    return;
+  }
+  if (*matches_len + len >= matches_size) {
+    len = matches_size - *matches_len - 1;
+  }
+  memcpy(&matches[*matches_len], string, len);
+  *matches_len += len;
+  matches[*matches_len] = '\0';
+}
+
 int sl_cli_command_find_matches(sl_cli_handle_t handle,
                                 char *possible_matches,
                                 size_t possible_matches_size,
@@ -348,6 +396,7 @@ int sl_cli_command_find_matches(sl_cli_handle_t handle,
   char *token_v[SL_CLI_MAX_INPUT_ARGUMENTS];
   char *buf;
   int token_c;
+  size_t matches_len = strlen(possible_matches);
 
   *input_length = 0;
   *input_position = 0;
@@ -399,20 +448,20 @@ int sl_cli_command_find_matches(sl_cli_handle_t handle,
         } else if (handle->input_len - *input_position <= table_entry_length) {
           // Will only show the total possible matches up to length of the
           // input buffer, and add "..." if there are more possible matches
-          if (strlen(possible_matches) + strlen(table[i].name)
+          if (matches_len + (size_t)table_entry_length
               >= SL_CLI_INPUT_BUFFER_SIZE - 4) {
-            sl_strcat_s(possible_matches, possible_matches_size, "... ");
+            append_match(possible_matches, possible_matches_size, &matches_len, "... ");
             break;
           }
           number_of_matches++;
-          sl_strcat_s(possible_matches, possible_matches_size, table[i].name);
-          sl_strcat_s(possible_matches, possible_matches_size, " ");
+          append_match(possible_matches, possible_matches_size, &matches_len, table[i].name);
+          append_match(possible_matches, possible_matches_size, &matches_len, " ");
         } else if ((table[i].command->arg_type_list[0] == SL_CLI_ARG_GROUP) && (arg_ofs == (token_c - 1))) {
           int k = 0;
           table = (sl_cli_command_entry_t *)(table[i].command->function);
           while (table[k].name) {
-            sl_strcat_s(possible_matches, possible_matches_size, table[k].name);
-            sl_strcat_s(possible_matches, possible_matches_size, " ");
+            append_match(possible_matches, possible_matches_size, &matches_len, table[k].name);
+            append_match(possible_matches, possible_matches_size, &matches_len, " ");
             number_of_matches++;
             k++;
           }
@@ -441,6 +490,196 @@ int sl_cli_command_find_matches(sl_cli_handle_t handle,
 }
 #endif // SL_CLI_ADVANCED_INPUT_HANDLING
 
+#if SL_CLI_COMMAND_INDEX_SIZE
+/***************************************************************************//**
+ * @brief
+ *   Calculate the command lookup index slot for a name in a command table.
+ *   The name is hashed with FNV-1a, folding the case if the command case is
+ *   ignored, and mixed with the address of the table owning the entry.
+ *
+ * @param[in] table     Table owning the entry, NULL for the root level.
+ *
+ * @param[in] name      Command or group name.
+ *
+ * @return              The first slot to probe.
+ ******************************************************************************/
+static uint32_t command_index_hash(const sl_cli_command_entry_t *table,
+                                   const char *name)
+{
+  uint32_t hash = 2166136261UL;
+
+  while (*name != '\0') {
+#if SL_CLI_IGNORE_COMMAND_CASE
+    hash ^= (uint32_t)tolower((unsigned char)*name);
+#else
+    hash ^= (uint32_t)(unsigned char)*name;
+#endif
+    hash *= 16777619UL;
+    name++;
+  }
+  hash ^= (uint32_t)(uintptr_t)table;
+  hash *= 0x9E3779B1UL;
+
+  return (hash >> 16) & (SL_CLI_COMMAND_INDEX_SIZE - 1);
+}
+
+/***************************************************************************//**
+ * @brief
+ *   Add the entries of a command table to the command lookup index. Group
+ *   tables are added recursively. An already indexed name is kept, so the
+ *   first match wins in the same way as for the linear search.
+ *
+ * @param[in, out] handle   A handle to a CLI instance.
+ *
+ * @param[in] key           Table key, NULL for the root level.
+ *
+ * @param[in] table         Command table to add.
+ *
+ * @return                  false if the index is full, true otherwise.
+ ******************************************************************************/
+static bool command_index_add_table(sl_cli_handle_t handle,
+                                    const sl_cli_command_entry_t *key,
+                                    const sl_cli_command_entry_t *table)
+{
+  const sl_cli_command_entry_t *cmd_entry;
+  sl_cli_command_index_slot_t *slot;
+  uint32_t pos;
+  uint32_t probes;
+  bool inserted;
+
+  for (cmd_entry = table; cmd_entry->name != NULL; cmd_entry++) {
+    pos = command_index_hash(key, cmd_entry->name);
+    inserted = false;
+    for (probes = 0; probes < SL_CLI_COMMAND_INDEX_SIZE; probes++) {
+      slot = &handle->command_index[pos];
+      if (slot->entry == NULL) {
+        slot->table = key;
+        slot->entry = cmd_entry;
+        inserted = true;
+        break;
+      }
+      if ((slot->table == key)
+          && (cmd_strcmp(slot->entry->name, cmd_entry->name) == 0)) {
+        // Name is shadowed by an earlier entry
+        break;
+      }
+      pos = (pos + 1) & (SL_CLI_COMMAND_INDEX_SIZE - 1);
+    }
+    if (probes == SL_CLI_COMMAND_INDEX_SIZE) {
+      return false;
+    }
+    if (inserted && (cmd_entry->command->arg_type_list[0] == SL_CLI_ARG_GROUP)) {
+      const sl_cli_command_entry_t *group_table = (sl_cli_command_entry_t *)(cmd_entry->command->function);
+      if (!command_index_add_table(handle, group_table, group_table)) {
+        return false;
+      }
+    }
+  }
+
+  return true;
+}
+
+/***************************************************************************//**
+ * @brief
+ *   Rebuild the command lookup index from the registered command groups if
+ *   the command groups have changed since the last build.
+ *
+ * @param[in, out] handle   A handle to a CLI instance.
+ *
+ * @return                  true if the index can be used, false otherwise.
+ ******************************************************************************/
+static bool command_index_update(sl_cli_handle_t handle)
+{
+  sl_cli_command_group_t *cmd_group;
+
+  if (handle->command_index_state == SLI_CLI_COMMAND_INDEX_STALE) {
+    memset(handle->command_index, 0, sizeof(handle->command_index));
+    handle->command_index_state = SLI_CLI_COMMAND_INDEX_READY;
+    SL_SLIST_FOR_EACH_ENTRY(handle->command_group, cmd_group, sl_cli_command_group_t, node) {
+      if ((cmd_group->command_table != NULL)
+          && !command_index_add_table(handle, NULL, cmd_group->command_table)) {
+        handle->command_index_state = SLI_CLI_COMMAND_INDEX_UNUSABLE;
+        break;
+      }
+    }
+  }
+
+  return handle->command_index_state == SLI_CLI_COMMAND_INDEX_READY;
+}
+
+/***************************************************************************//**
+ * @brief
+ *   Look up a name in the command lookup index.
+ *
+ * @param[in] handle    A handle to a CLI instance.
+ *
+ * @param[in] key       Table key, NULL for the root level.
+ *
+ * @param[in] name      Command or group name.
+ *
+ * @return              A pointer to the entry, NULL if not found.
+ ******************************************************************************/
+static const sl_cli_command_entry_t *command_index_lookup(sl_cli_handle_t handle,
+                                                          const sl_cli_command_entry_t *key,
+                                                          const char *name)
+{
+  const sl_cli_command_index_slot_t *slot;
+  uint32_t pos = command_index_hash(key, name);
+  uint32_t probes;
+
+  for (probes = 0; probes < SL_CLI_COMMAND_INDEX_SIZE; probes++) {
+    slot = &handle->command_index[pos];
+    if (slot->entry == NULL) {
+      break;
+    }
+    if ((slot->table == key) && (cmd_strcmp(slot->entry->name, name) == 0)) {
+      return slot->entry;
+    }
+    pos = (pos + 1) & (SL_CLI_COMMAND_INDEX_SIZE - 1);
+  }
+
+  return NULL;
+}
+
+/***************************************************************************//**
+ * @brief
+ *   Find a command with the command lookup index. The result is the same as
+ *   for the linear search with scan_entry().
+ ******************************************************************************/
+static const sl_cli_command_entry_t *command_index_find(sl_cli_handle_t handle,
+                                                        int *token_c,
+                                                        char *token_v[],
+                                                        int *arg_ofs,
+                                                        bool *single_flag,
+                                                        bool *help_flag)
+{
+  const sl_cli_command_entry_t *table = NULL;
+  const sl_cli_command_entry_t *cmd_entry;
+
+  while (*arg_ofs < *token_c) {
+    cmd_entry = command_index_lookup(handle, table, token_v[*arg_ofs]);
+    if (cmd_entry == NULL) {
+      break;
+    }
+    (*arg_ofs)++;
+    if (cmd_entry->command->arg_type_list[0] != SL_CLI_ARG_GROUP) {
+      // Command found, stop search
+      *single_flag = true;
+      return cmd_entry;
+    }
+    // Group found, continue search
+    table = (sl_cli_command_entry_t *)(cmd_entry->command->function);
+  }
+
+  if (table != NULL) {
+    // Incomplete command within a group, show the group help
+    *help_flag = true;
+  }
+
+  return table;
+}
+#endif // SL_CLI_COMMAND_INDEX_SIZE
+
 static const sl_cli_command_entry_t *scan_entry(const sl_cli_command_entry_t *cmd_entry_in,
                                                 bool group,
                                                 bool *found,
@@ -504,15 +743,22 @@ const sl_cli_command_entry_t *sl_cli_command_find(sl_cli_handle_t handle,
     (*arg_ofs)++;
   }
 
-  sl_cli_command_group_t *cmd_group;
-  SL_SLIST_FOR_EACH_ENTRY(handle->command_group, cmd_group, sl_cli_command_group_t, node) {
-    cmd_entry = cmd_group->command_table;
-    if (cmd_entry == NULL) {
-      continue;
-    }
-    cmd_entry = scan_entry(cmd_entry, false, &found, token_c, token_v, arg_ofs, single_flag, help_flag);
-    if (found) {
-      break;
+#if SL_CLI_COMMAND_INDEX_SIZE
+  if (command_index_update(handle)) {
+    cmd_entry = command_index_find(handle, token_c, token_v, arg_ofs, single_flag, help_flag);
+  } else
+#endif
+  {
+    sl_cli_command_group_t *cmd_group;
+    SL_SLIST_FOR_EACH_ENTRY(handle->command_group, cmd_group, sl_cli_command_group_t, node) {
+      cmd_entry = cmd_group->command_table;
+      if (cmd_entry == NULL) {
+        continue;
+      }
+      cmd_entry = scan_entry(cmd_entry, false, &found, token_c, token_v, arg_ofs, single_flag, help_flag);
+      if (found) {
+        break;
+      }
     }
   }
   if (help) {
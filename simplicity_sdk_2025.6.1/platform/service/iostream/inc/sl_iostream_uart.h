@@ -43,6 +43,7 @@ extern "C" {
 
 #include "em_device.h"
 #include "sl_status.h"
+#include "sl_enum.h"
 #include "sl_iostream.h"
 #include "sl_slist.h"
 #include "sl_status.h"
@@ -141,6 +142,29 @@ extern "C" {
  *    the EUSART peripheral, which boasts a 16Bytes FIFO, allow for baudrate of
  *    upwards of 921600 without data loss with no hardware flow control.
  *
+ * ### TX Buffer
+ *
+ *    By default, the write API pushes every byte into the peripheral FIFO and
+ *    only returns once the last byte has been handed to the UART. When a TX
+ *    buffer is provided in the configuration, writes are instead copied into a
+ *    ring buffer that is drained in the background by the TX (L)DMA channel,
+ *    so printf and CLI output only cost a memory copy.
+ *
+ *    The TX buffer length must be a power of two. Producers reserve room in the
+ *    ring inside a short atomic section and copy their data with interrupts
+ *    enabled, which makes the write API usable from interrupt context. When the
+ *    ring is full, the configured policy applies:
+ *    - `SL_IOSTREAM_UART_TX_POLICY_BLOCK` waits for the DMA to free up room.
+ *      Writes issued from interrupt context or with interrupts disabled cannot
+ *      wait and fall back to dropping the bytes that do not fit.
+ *    - `SL_IOSTREAM_UART_TX_POLICY_DROP` discards the bytes that do not fit.
+ *    - `SL_IOSTREAM_UART_TX_POLICY_OVERWRITE` discards the oldest bytes not yet
+ *      handed to the DMA. Bytes from an on-going DMA transfer are never
+ *      discarded, so a write may still be truncated while a transfer runs.
+ *
+ *    The TX buffer is ignored when software flow control is enabled, as XON/XOFF
+ *    handling requires byte-per-byte transmission.
+ *
  * @{
  ******************************************************************************/
 
@@ -191,6 +215,21 @@ typedef sl_hal_ldma_transfer_config_t LDMA_TransferCfg_t;
 #define UARTXON     0x11                           ///< uartx on
 #define UARTXOFF    0x13                           ///< uartx off
 
+/// @brief I/O Stream UART TX buffer full policy
+SL_ENUM(sl_iostream_uart_tx_policy_t){
+  SL_IOSTREAM_UART_TX_POLICY_BLOCK = 0,      ///< Wait for room in the TX buffer
+  SL_IOSTREAM_UART_TX_POLICY_DROP = 1,       ///< Discard the bytes that do not fit
+  SL_IOSTREAM_UART_TX_POLICY_OVERWRITE = 2,  ///< Discard the oldest pending bytes
+};
+
+/// @brief I/O Stream UART TX buffer statistics
+typedef struct {
+  uint32_t bytes_queued;                    ///< Bytes accepted in the TX buffer
+  uint32_t bytes_dropped;                   ///< Bytes discarded because the TX buffer was full
+  uint32_t writes_truncated;                ///< Writes that lost at least one byte
+  uint32_t high_watermark;                  ///< Highest TX buffer occupancy observed, in bytes
+} sl_iostream_uart_tx_stats_t;
+
 /// @brief I/O Stream UART stream object
 typedef struct {
   sl_iostream_t stream;                                               ///< stream
@@ -253,6 +292,9 @@ typedef struct {
   sl_iostream_dma_config_t tx_dma_cfg;      ///< TX DMA Config
   uint8_t *rx_buffer;                       ///< UART Rx Buffer
   size_t rx_buffer_length;                  ///< UART Rx Buffer length
+  uint8_t *tx_buffer;                       ///< UART Tx ring buffer, NULL for unbuffered TX
+  size_t tx_buffer_length;                  ///< UART Tx ring buffer length, must be a power of two
+  sl_iostream_uart_tx_policy_t tx_policy;   ///< Policy applied when the Tx ring buffer is full
   bool lf_to_crlf;                          ///< lf_to_crlf
   bool enable_high_frequency;               ///< enable_high_frequency
   bool rx_when_sleeping;                    ///< rx_when_sleeping
@@ -283,8 +325,18 @@ typedef struct {
   // Tx Context
   sl_iostream_tx_dma_context_t tx_dma;      ///< DMA TX Context
   bool  async_transfer_in_progress;         ///< TX DMA transfer active flag
-  sl_slist_node_t  *pending_write_ops;      ///< Head pointer for pending async write ops.
+  sl_slist_queue_t pending_write_ops;       ///< Pending async write ops.
   bool async_tx_mode;                       ///< Asynchronous tx mode
+  uint8_t *tx_buffer;                       ///< UART Tx ring buffer, NULL for unbuffered TX
+  size_t tx_buffer_mask;                    ///< UART Tx ring buffer length minus one
+  volatile size_t tx_reserve_idx;           ///< Free-running index of the next byte to be reserved by a producer
+  volatile size_t tx_commit_idx;            ///< Free-running index up to which bytes can be sent
+  volatile size_t tx_read_idx;              ///< Free-running index of the next byte to be handed to the DMA
+  volatile size_t tx_free_idx;              ///< Free-running index of the oldest byte still owned by the ring
+  volatile uint8_t tx_writers;              ///< Number of producers copying into the Tx ring buffer
+  volatile bool tx_dma_busy;                ///< Tx ring buffer DMA transfer active flag
+  sl_iostream_uart_tx_policy_t tx_policy;   ///< Policy applied when the Tx ring buffer is full
+  sl_iostream_uart_tx_stats_t tx_stats;     ///< Tx ring buffer statistics
 #if defined(SL_CATALOG_POWER_MANAGER_PRESENT)
   volatile bool tx_idle;                    ///< Indicates if the transmitter is idle, keeping the clock enabled until idle is reached
   bool em_req_added;                        ///< em_req_added. Available only when Power Manager present.
@@ -352,6 +404,32 @@ __STATIC_INLINE bool sl_iostream_uart_get_auto_cr_lf(sl_iostream_uart_t *iostrea
   return iostream_uart->get_auto_cr_lf(iostream_uart->stream.context);
 }
 
+/***************************************************************************//**
+ * Wait until all the data held in the TX buffer has been sent.
+ *
+ * @param[in] iostream_uart  UART stream object.
+ *
+ * @return  SL_STATUS_OK if the TX buffer is empty or TX is not buffered.
+ *          SL_STATUS_WOULD_BLOCK if called from interrupt context or with
+ *          interrupts disabled while data is still pending.
+ ******************************************************************************/
+sl_status_t sl_iostream_uart_flush_tx(sl_iostream_uart_t *iostream_uart);
+
+/***************************************************************************//**
+ * Get the TX buffer statistics.
+ *
+ * @param[in] iostream_uart  UART stream object.
+ *
+ * @param[out] stats  Copy of the TX buffer statistics.
+ *
+ * @param[in] reset  If true, statistics are cleared after being copied.
+ *
+ * @return  SL_STATUS_OK, or SL_STATUS_NOT_AVAILABLE if TX is not buffered.
+ ******************************************************************************/
+sl_status_t sl_iostream_uart_get_tx_stats(sl_iostream_uart_t *iostream_uart,
+                                          sl_iostream_uart_tx_stats_t *stats,
+                                          bool reset);
+
 #if defined(SL_CATALOG_POWER_MANAGER_PRESENT)
 /***************************************************************************//**
  * Set next byte detect IRQ.
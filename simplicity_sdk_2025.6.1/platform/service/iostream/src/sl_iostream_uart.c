@@ -151,6 +151,20 @@ static size_t read_rx_buffer(sl_iostream_uart_context_t * uart_context,
 
 static void __uart_async_start_write(sli_iostream_write_async_op_t *async_op);
 
+static sl_status_t tx_ring_write(sl_iostream_uart_context_t *uart_context,
+                                 const void *buffer,
+                                 size_t buffer_length);
+
+static sl_status_t tx_ring_polled_write(sl_iostream_uart_context_t *uart_context,
+                                        const uint8_t *buffer,
+                                        size_t buffer_length,
+                                        bool cr_written);
+
+static void __tx_ring_start_dma(sl_iostream_uart_context_t *uart_context);
+
+static bool __tx_ring_dma_callback(unsigned int channel, unsigned int sequenceNo,
+                                   void *userParam);
+
 /*******************************************************************************
  **************************   GLOBAL FUNCTIONS   *******************************
  ******************************************************************************/
@@ -181,6 +195,16 @@ sl_status_t sli_iostream_uart_context_init(sl_iostream_uart_t *uart,
 #if defined(SL_CATALOG_POWER_MANAGER_PRESENT)
   context->enable_high_frequency = config->enable_high_frequency;
 #endif
+
+  // Buffered TX is not compatible with XON/XOFF, which requires byte-per-byte transmission.
+  if (config->tx_buffer != NULL && config->tx_buffer_length > 0 && !config->sw_flow_control) {
+    if ((config->tx_buffer_length & (config->tx_buffer_length - 1)) != 0) {
+      return SL_STATUS_INVALID_CONFIGURATION;
+    }
+    context->tx_buffer = config->tx_buffer;
+    context->tx_buffer_mask = config->tx_buffer_length - 1;
+    context->tx_policy = config->tx_policy;
+  }
   uart->stream.context = context;
   uart->stream.write = uart_write;
   uart->stream.write_async = uart_write_async;
@@ -278,7 +302,7 @@ sl_status_t sli_iostream_uart_context_init(sl_iostream_uart_t *uart,
   NVIC_ClearPendingIRQ(config->uart_periph->rx_irq_number);
   NVIC_EnableIRQ(config->uart_periph->rx_irq_number);
 
-  sl_slist_init(&context->pending_write_ops);
+  sl_slist_queue_init(&context->pending_write_ops);
 
   sl_iostream_set_system_default(&uart->stream);
 
@@ -341,6 +365,61 @@ sl_status_t sli_iostream_uart_unsubscribe_to_new_data(sl_iostream_uart_t *iostre
   return SL_STATUS_OK;
 }
 
+/***************************************************************************//**
+ * Wait until all the data held in the TX buffer has been sent.
+ ******************************************************************************/
+sl_status_t sl_iostream_uart_flush_tx(sl_iostream_uart_t *iostream_uart)
+{
+  const sl_iostream_uart_context_t *uart_context = (sl_iostream_uart_context_t *)iostream_uart->stream.context;
+
+  if (uart_context->tx_buffer == NULL) {
+    return SL_STATUS_OK;
+  }
+
+  while (uart_context->tx_dma_busy
+         || uart_context->tx_read_idx != uart_context->tx_reserve_idx) {
+    if (CORE_IN_IRQ_CONTEXT() || CORE_IRQ_DISABLED()) {
+      // The DMA completion IRQ can't run, the ring will never drain.
+      return SL_STATUS_WOULD_BLOCK;
+    }
+#if defined(SL_CATALOG_KERNEL_PRESENT)
+    if (osKernelGetState() == osKernelRunning) {
+      osDelay(1);
+    }
+#endif
+  }
+
+  return SL_STATUS_OK;
+}
+
+/***************************************************************************//**
+ * Get the TX buffer statistics.
+ ******************************************************************************/
+sl_status_t sl_iostream_uart_get_tx_stats(sl_iostream_uart_t *iostream_uart,
+                                          sl_iostream_uart_tx_stats_t *stats,
+                                          bool reset)
+{
+  sl_iostream_uart_context_t *uart_context = (sl_iostream_uart_context_t *)iostream_uart->stream.context;
+  CORE_DECLARE_IRQ_STATE;
+
+  if (stats == NULL) {
+    return SL_STATUS_NULL_POINTER;
+  }
+
+  if (uart_context->tx_buffer == NULL) {
+    return SL_STATUS_NOT_AVAILABLE;
+  }
+
+  CORE_ENTER_ATOMIC();
+  *stats = uart_context->tx_stats;
+  if (reset) {
+    memset(&uart_context->tx_stats, 0, sizeof(uart_context->tx_stats));
+  }
+  CORE_EXIT_ATOMIC();
+
+  return SL_STATUS_OK;
+}
+
 /***************************************************************************//**
  * Set new data detect to wake from sleep.
  ******************************************************************************/
@@ -582,7 +661,7 @@ void sli_uart_txc(void *context)
   CORE_DECLARE_IRQ_STATE;
 
   CORE_ENTER_ATOMIC();
-  if (uart_context->tx_idle == false) {
+  if (uart_context->tx_idle == false && !uart_context->tx_dma_busy) {
     EFM_ASSERT(uart_context->uart_periph->tx_completed != NULL);
     uart_context->uart_periph->tx_completed(context, false);
     uart_context->tx_idle = true;
@@ -617,6 +696,10 @@ static sl_status_t uart_deinit(void *stream)
 
   sli_iostream_uart_unsubscribe_to_new_data(uart);
 
+  // Let the TX buffer drain before the peripheral goes away.
+  status = sl_iostream_uart_flush_tx(uart);
+  EFM_ASSERT(status == SL_STATUS_OK);
+
 #if (defined(SL_CATALOG_KERNEL_PRESENT))
   if (osKernelGetState() == osKernelRunning) {
     // Acquire locks to ensure no others task try to perform operation on the stream at sametime
@@ -835,6 +918,11 @@ static sl_status_t uart_write(void *context,
     return SL_STATUS_NOT_AVAILABLE;         // Can't do synchronous calls in async TX mode
   }
 
+  if (uart_context->tx_buffer != NULL) {
+    // The TX ring is safe for concurrent producers, no need for the write lock.
+    return tx_ring_write((sl_iostream_uart_context_t *)context, buffer, buffer_length);
+  }
+
 #if (defined(SL_CATALOG_KERNEL_PRESENT))
   osStatus_t status;
   if (osKernelGetState() == osKernelRunning) {
@@ -874,7 +962,7 @@ static bool __uart_async_tx_dma_callback(unsigned int channel, unsigned int sequ
   EFM_ASSERT(uart_context->async_transfer_in_progress);
 
   uart_context->async_transfer_in_progress = false;
-  node = sl_slist_pop(&uart_context->pending_write_ops);
+  node = sl_slist_queue_pop(&uart_context->pending_write_ops);
   if (node != NULL) {
     async_op = SL_SLIST_ENTRY(node, sli_iostream_write_async_op_t, node);
     __uart_async_start_write(async_op);
@@ -916,7 +1004,7 @@ static sl_status_t uart_write_async(void *context, sli_iostream_write_async_op_t
 {
   sl_iostream_uart_context_t *uart_context = (sl_iostream_uart_context_t *)context;
 
-  if (!uart_context->async_tx_mode) {
+  if (!uart_context->async_tx_mode || uart_context->tx_buffer != NULL) {
     return SL_STATUS_NOT_AVAILABLE;
   }
 
@@ -929,7 +1017,7 @@ static sl_status_t uart_write_async(void *context, sli_iostream_write_async_op_t
   async_op->context = uart_context;
 
   if (uart_context->async_transfer_in_progress) {
-    sl_slist_push_back(&uart_context->pending_write_ops, &async_op->node);
+    sl_slist_queue_push_back(&uart_context->pending_write_ops, &async_op->node);
   } else {
     __uart_async_start_write(async_op);
   }
@@ -939,6 +1027,300 @@ static sl_status_t uart_write_async(void *context, sli_iostream_write_async_op_t
   return SL_STATUS_OK;
 }
 
+/***************************************************************************//**
+ * Copy data into the TX ring, starting at the given free-running index.
+ *
+ * Performs the LF to CRLF conversion on the fly and always fills exactly
+ * ring_len bytes, unless the source runs out. When only the CR of a CRLF pair
+ * fits, cr_written is set so that the next call emits the LF alone. Returns
+ * the number of source bytes consumed.
+ ******************************************************************************/
+static size_t tx_ring_copy(const sl_iostream_uart_context_t *uart_context,
+                           size_t ring_idx,
+                           size_t ring_len,
+                           const uint8_t *src,
+                           size_t src_len,
+                           bool lf_to_crlf,
+                           bool *cr_written)
+{
+  size_t consumed = 0;
+  size_t offset;
+  size_t chunk;
+
+  if (!lf_to_crlf) {
+    consumed = (src_len < ring_len) ? src_len : ring_len;
+    offset = ring_idx & uart_context->tx_buffer_mask;
+    chunk = (uart_context->tx_buffer_mask + 1) - offset;
+    chunk = (chunk < consumed) ? chunk : consumed;
+    memcpy(&uart_context->tx_buffer[offset], src, chunk);
+    memcpy(uart_context->tx_buffer, src + chunk, consumed - chunk);
+    return consumed;
+  }
+
+  while (ring_len > 0 && consumed < src_len) {
+    if (src[consumed] == '\n' && !*cr_written) {
+      uart_context->tx_buffer[ring_idx++ & uart_context->tx_buffer_mask] = '\r';
+      ring_len--;
+      *cr_written = true;
+      continue;
+    }
+    uart_context->tx_buffer[ring_idx++ & uart_context->tx_buffer_mask] = src[consumed++];
+    ring_len--;
+    *cr_written = false;
+  }
+
+  return consumed;
+}
+
+/***************************************************************************//**
+ * Buffered stream write implementation.
+ *
+ * Producers reserve room in the ring in a short atomic section and copy their
+ * data with interrupts enabled. Reserved bytes are only made visible to the DMA
+ * once every concurrent producer is done copying, so that an interrupting
+ * producer can never get its data sent ahead of uncopied bytes.
+ ******************************************************************************/
+static sl_status_t tx_ring_write(sl_iostream_uart_context_t *uart_context,
+                                 const void *buffer,
+                                 size_t buffer_length)
+{
+  const uint8_t *src = (const uint8_t *)buffer;
+  const size_t ring_size = uart_context->tx_buffer_mask + 1;
+  bool lf_to_crlf = false;
+  bool cr_written = false;
+  bool truncated = false;
+  size_t needed;
+  size_t room;
+  size_t granted;
+  size_t reserve_idx;
+  size_t consumed;
+  size_t dropped;
+  size_t used;
+  CORE_DECLARE_IRQ_STATE;
+
+  sl_atomic_load(lf_to_crlf, uart_context->lf_to_crlf);
+
+  while (buffer_length > 0) {
+    needed = buffer_length;
+    if (lf_to_crlf) {
+      for (size_t i = 0; i < buffer_length; i++) {
+        if (src[i] == '\n') {
+          needed++;
+        }
+      }
+      if (cr_written) {
+        needed--;
+      }
+    }
+
+    CORE_ENTER_ATOMIC();
+    room = ring_size - (uart_context->tx_reserve_idx - uart_context->tx_free_idx);
+    if (needed > room && uart_context->tx_policy == SL_IOSTREAM_UART_TX_POLICY_OVERWRITE) {
+      // Discard the oldest committed bytes that have not been handed to the DMA yet.
+      // Their room can only be reused right away when no transfer is on-going,
+      // otherwise it is reclaimed when the current transfer completes.
+      dropped = uart_context->tx_commit_idx - uart_context->tx_read_idx;
+      dropped = (dropped < (needed - room)) ? dropped : (needed - room);
+      uart_context->tx_read_idx += dropped;
+      uart_context->tx_stats.bytes_dropped += dropped;
+      if (!uart_context->tx_dma_busy) {
+        uart_context->tx_free_idx = uart_context->tx_read_idx;
+        room += dropped;
+      }
+    }
+    granted = (needed < room) ? needed : room;
+    reserve_idx = uart_context->tx_reserve_idx;
+    uart_context->tx_reserve_idx += granted;
+    uart_context->tx_writers++;
+    used = uart_context->tx_reserve_idx - uart_context->tx_free_idx;
+    if (used > uart_context->tx_stats.high_watermark) {
+      uart_context->tx_stats.high_watermark = used;
+    }
+    CORE_EXIT_ATOMIC();
+
+    consumed = tx_ring_copy(uart_context, reserve_idx, granted, src, buffer_length, lf_to_crlf, &cr_written);
+
+    CORE_ENTER_ATOMIC();
+    uart_context->tx_writers--;
+    if (uart_context->tx_writers == 0) {
+      uart_context->tx_commit_idx = uart_context->tx_reserve_idx;
+      __tx_ring_start_dma(uart_context);
+    }
+    uart_context->tx_stats.bytes_queued += consumed;
+    CORE_EXIT_ATOMIC();
+
+    src += consumed;
+    buffer_length -= consumed;
+
+    if (buffer_length == 0) {
+      break;
+    }
+
+    // The ring is full
+    if (uart_context->tx_policy == SL_IOSTREAM_UART_TX_POLICY_BLOCK
+        && (CORE_IN_IRQ_CONTEXT() || CORE_IRQ_DISABLED())) {
+      // The DMA completion IRQ can't run to make room, send the rest polled.
+      return tx_ring_polled_write(uart_context, src, buffer_length, cr_written);
+    }
+    if (uart_context->tx_policy != SL_IOSTREAM_UART_TX_POLICY_BLOCK) {
+      CORE_ENTER_ATOMIC();
+      uart_context->tx_stats.bytes_dropped += buffer_length;
+      CORE_EXIT_ATOMIC();
+      truncated = true;
+      break;
+    }
+
+    // Wait for the DMA to make some room
+    while ((uart_context->tx_reserve_idx - uart_context->tx_free_idx) == ring_size) {
+#if defined(SL_CATALOG_KERNEL_PRESENT)
+      if (osKernelGetState() == osKernelRunning) {
+        // Let a preempted producer commit its data
+        osDelay(1);
+      }
+#endif
+    }
+  }
+
+  if (truncated) {
+    CORE_ENTER_ATOMIC();
+    uart_context->tx_stats.writes_truncated++;
+    CORE_EXIT_ATOMIC();
+    return SL_STATUS_FULL;
+  }
+
+  return SL_STATUS_OK;
+}
+
+/***************************************************************************//**
+ * Polled fallback of the buffered write, used when the ring is full and the
+ * caller can't wait for the DMA completion interrupt.
+ *
+ * Waits for the on-going transfer, sends the committed bytes that were not
+ * handed to the DMA yet and then the rest of the data, so that ordering is
+ * kept. The transfer stays flagged busy until its completion interrupt runs,
+ * which reclaims the ring room. Bytes reserved by an interrupted producer are
+ * not committed yet and are sent after this data.
+ ******************************************************************************/
+static sl_status_t tx_ring_polled_write(sl_iostream_uart_context_t *uart_context,
+                                        const uint8_t *buffer,
+                                        size_t buffer_length,
+                                        bool cr_written)
+{
+  sl_status_t status = SL_STATUS_OK;
+  bool active = true;
+  CORE_DECLARE_IRQ_STATE;
+
+  CORE_ENTER_ATOMIC();
+  while (uart_context->tx_dma_busy && active) {
+    DMADRV_TransferActive(uart_context->tx_dma.channel, &active);
+  }
+
+  while (uart_context->tx_read_idx != uart_context->tx_commit_idx) {
+    uart_context->uart_periph->tx(uart_context,
+                                  (char)uart_context->tx_buffer[uart_context->tx_read_idx & uart_context->tx_buffer_mask]);
+    uart_context->tx_read_idx++;
+  }
+  if (!uart_context->tx_dma_busy) {
+    uart_context->tx_free_idx = uart_context->tx_read_idx;
+  }
+
+  if (cr_written) {
+    // The CR of this CRLF pair is already out
+    status = uart_context->uart_periph->tx(uart_context, (char)*buffer);
+    buffer++;
+    buffer_length--;
+  }
+  if (status == SL_STATUS_OK && buffer_length > 0) {
+    status = nolock_uart_write(uart_context, buffer, buffer_length);
+  }
+  CORE_EXIT_ATOMIC();
+
+  return status;
+}
+
+/***************************************************************************//**
+ * Hand the next contiguous run of committed bytes to the TX DMA (must be
+ * called in atomic section, including from the DMA completion callback).
+ ******************************************************************************/
+static void __tx_ring_start_dma(sl_iostream_uart_context_t *uart_context)
+{
+  Ecode_t ecode;
+  size_t pending;
+  size_t offset;
+  size_t chunk;
+
+  if (uart_context->tx_dma_busy) {
+    return;
+  }
+
+  // Bytes skipped by the overwrite policy are reclaimed here
+  uart_context->tx_free_idx = uart_context->tx_read_idx;
+
+  pending = uart_context->tx_commit_idx - uart_context->tx_read_idx;
+  if (pending == 0) {
+#if defined(SL_CATALOG_POWER_MANAGER_PRESENT) && !defined(SL_IOSTREAM_UART_FLUSH_TX_BUFFER)
+    if (!uart_context->tx_idle) {
+      // Ring drained, release the EM1 requirement once the shift register is empty.
+      uart_context->uart_periph->tx_completed(uart_context, true);
+    }
+#endif
+    return;
+  }
+
+#if defined(SL_CATALOG_POWER_MANAGER_PRESENT) && !defined(SL_IOSTREAM_UART_FLUSH_TX_BUFFER)
+  if (uart_context->tx_idle == true && uart_context->enable_high_frequency) {
+    uart_context->tx_idle = false;
+    sl_power_manager_add_em_requirement(SL_POWER_MANAGER_EM1);
+  }
+  if (!uart_context->tx_idle) {
+    // TXC can assert between two transfers, don't let it release the EM1 requirement.
+    uart_context->uart_periph->tx_completed(uart_context, false);
+  }
+#endif
+
+  offset = uart_context->tx_read_idx & uart_context->tx_buffer_mask;
+  chunk = (uart_context->tx_buffer_mask + 1) - offset;
+  chunk = (chunk < pending) ? chunk : pending;
+  chunk = (chunk < IOSTREAM_LDMA_MAX_XFER_SIZE) ? chunk : IOSTREAM_LDMA_MAX_XFER_SIZE;
+
+  uart_context->tx_dma.desc = (LDMA_Descriptor_t)
+                              IOSTREAM_LDMA_DESCRIPTOR_SINGLE_M2P_BYTE(&uart_context->tx_buffer[offset],
+                                                                       uart_context->tx_dma.cfg.dst,
+                                                                       chunk);
+  uart_context->tx_read_idx += chunk;
+  uart_context->tx_dma_busy = true;
+  ecode = DMADRV_LdmaStartTransfer(uart_context->tx_dma.channel,
+                                   &uart_context->tx_dma.cfg.xfer_cfg,
+                                   &uart_context->tx_dma.desc,
+                                   __tx_ring_dma_callback,
+                                   uart_context);
+  EFM_ASSERT(ecode == ECODE_OK);
+}
+
+/***************************************************************************//**
+ * Callback function for UART TX ring DMA completion.
+ ******************************************************************************/
+static bool __tx_ring_dma_callback(unsigned int channel, unsigned int sequenceNo,
+                                   void *userParam)
+{
+  sl_iostream_uart_context_t *uart_context = (sl_iostream_uart_context_t *)userParam;
+  CORE_DECLARE_IRQ_STATE;
+  (void)channel;
+  (void)sequenceNo;
+
+  EFM_ASSERT(uart_context->tx_dma_busy);
+
+  // Only committed bytes are sent, a producer interrupted while copying will
+  // restart the DMA itself if it finds it idle when committing. A producer
+  // running in a higher priority interrupt must not see the ring in between.
+  CORE_ENTER_ATOMIC();
+  uart_context->tx_dma_busy = false;
+  __tx_ring_start_dma(uart_context);
+  CORE_EXIT_ATOMIC();
+
+  return false;
+}
+
 /***************************************************************************//**
  * Internal stream read implementation
  ******************************************************************************/
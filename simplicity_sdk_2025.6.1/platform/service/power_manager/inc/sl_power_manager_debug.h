@@ -32,6 +32,7 @@
 #define SL_POWER_MANAGER_DEBUG_H
 
 #include "sl_power_manager.h"
+#include "sl_power_manager_config.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -42,6 +43,28 @@ extern "C" {
  * @{
  ******************************************************************************/
 
+#if (SL_POWER_MANAGER_STATISTICS == 1)
+// -----------------------------------------------------------------------------
+// Data Types
+
+/// Number of wake-ups attributed to one interrupt.
+typedef struct {
+  int16_t irqn;                         ///< Interrupt number, -1 if the entry is unused.
+  uint32_t count;                       ///< Number of wake-ups caused by this interrupt.
+} sl_power_manager_wakeup_source_t;
+
+/// Energy mode statistics accumulated since the last reset.
+typedef struct {
+  uint64_t em_residency_tick[SL_POWER_MANAGER_EM2 + 1];   ///< Sleeptimer ticks spent in EM0, EM1 and EM2.
+  uint32_t sleep_count;                 ///< Number of times the sleep loop put the core to sleep.
+  uint32_t sleep_rejected_count;        ///< Sleeps rejected by sl_power_manager_is_ok_to_sleep().
+  uint32_t em1_requirement_count;       ///< Sleeps limited to EM1 by an EM1 requirement.
+  uint32_t em1_min_offtime_count;       ///< Sleeps limited to EM1 because the next timer was closer than the minimum off-time or the wake-up delay.
+  uint32_t wakeup_unknown_count;        ///< Wake-ups without a pending interrupt, or from an interrupt missing from the table.
+  sl_power_manager_wakeup_source_t wakeup_source[SL_POWER_MANAGER_STATISTICS_WAKEUP_SOURCE_COUNT];   ///< Wake-ups per interrupt source.
+} sl_power_manager_statistics_t;
+#endif
+
 // -----------------------------------------------------------------------------
 // Prototypes
 
@@ -51,6 +74,22 @@ extern "C" {
  ******************************************************************************/
 void sl_power_manager_debug_print_em_requirements(void);
 
+#if (SL_POWER_MANAGER_STATISTICS == 1)
+/***************************************************************************//**
+ * Get the energy mode statistics.
+ *
+ * @param[out] statistics  Statistics accumulated since the last reset. The
+ *                         residency includes the time spent in the current
+ *                         energy mode so far.
+ ******************************************************************************/
+void sl_power_manager_get_statistics(sl_power_manager_statistics_t *statistics);
+
+/***************************************************************************//**
+ * Reset the energy mode statistics.
+ ******************************************************************************/
+void sl_power_manager_reset_statistics(void);
+#endif
+
 /** @} (end addtogroup power_manager) */
 
 #ifdef __cplusplus
@@ -196,6 +196,7 @@ sl_status_t sl_power_manager_init(void)
     sli_power_manager_debug_init();
   #endif
     sli_power_manager_em_transition_event_list_init();
+    sli_power_manager_statistics_init();
 
 #if !defined(SL_CATALOG_POWER_MANAGER_NO_DEEPSLEEP_PRESENT)
     // If lowest energy mode is not restricted to EM1, determine and set lowest energy mode
@@ -258,6 +259,7 @@ __NO_INLINE void sl_power_manager_sleep(void)
   sli_power_manager_suspend_log_transmission();
 
   if (sl_power_manager_is_ok_to_sleep() != true) {
+    sli_power_manager_statistics_on_sleep_rejected();
     sli_power_manager_resume_log_transmission();
     exit_critical_with_primask(primask_state);
     return;
@@ -315,8 +317,12 @@ __NO_INLINE void sl_power_manager_sleep(void)
       is_states_saved = true;
     }
 
+    sli_power_manager_statistics_on_sleep(lowest_em,
+                                          (requirement_on_em1_added && (requirement_em1 == 1)));
+
     // Apply lowest reachable energy mode
     sli_power_manager_apply_em(current_em);
+    sli_power_manager_statistics_on_wakeup();
 
     // In case we are waiting for the restore from an early wake-up,
     // we put back the current EM to the one before the early wake-up to do the next notification correctly.
@@ -384,10 +390,13 @@ __NO_INLINE void sl_power_manager_sleep(void)
       first_iteration = false;
     }
 
+    sli_power_manager_statistics_on_sleep(lowest_em, false);
+
     // Apply EM1 energy mode
     // Lowest EM is passed so that further actions can be taking by the HAL based on the EM requirements
     // but only EM1 sleep will be entered.
     sli_power_manager_apply_em(lowest_em);
+    sli_power_manager_statistics_on_wakeup();
 
     primask_state = yield_critical_with_primask(primask_state);
   } while (sl_power_manager_sleep_on_isr_exit() == true);
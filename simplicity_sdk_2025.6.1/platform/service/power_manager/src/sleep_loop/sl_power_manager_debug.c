@@ -136,6 +136,163 @@ static void power_manager_log_add_requirement(sl_slist_node_t **p_list,
 }
 #endif // SL_POWER_MANAGER_DEBUG
 
+#if (SL_POWER_MANAGER_STATISTICS == 1)
+#include "sl_sleeptimer.h"
+#include "em_core.h"
+#include "em_device.h"
+#include <string.h>
+
+#define EM_EVENT_MASK_ALL  (SL_POWER_MANAGER_EVENT_TRANSITION_ENTERING_EM0   \
+                            | SL_POWER_MANAGER_EVENT_TRANSITION_LEAVING_EM0  \
+                            | SL_POWER_MANAGER_EVENT_TRANSITION_ENTERING_EM1 \
+                            | SL_POWER_MANAGER_EVENT_TRANSITION_LEAVING_EM1  \
+                            | SL_POWER_MANAGER_EVENT_TRANSITION_ENTERING_EM2 \
+                            | SL_POWER_MANAGER_EVENT_TRANSITION_LEAVING_EM2)
+
+static void power_manager_statistics_on_em_transition(sl_power_manager_em_t from,
+                                                      sl_power_manager_em_t to);
+
+static sl_power_manager_statistics_t power_statistics;
+static sl_power_manager_em_t power_statistics_em = SL_POWER_MANAGER_EM0;
+static uint64_t power_statistics_em_entry_tick;
+
+static sl_power_manager_em_transition_event_handle_t power_statistics_event_handle;
+static const sl_power_manager_em_transition_event_info_t power_statistics_event_info = {
+  .event_mask = EM_EVENT_MASK_ALL,
+  .on_event = power_manager_statistics_on_em_transition,
+};
+
+/***************************************************************************//**
+ * Clear the statistics and restart the residency of the current energy mode.
+ *
+ * @note Must be called in a critical section.
+ ******************************************************************************/
+static void power_manager_statistics_clear(void)
+{
+  uint32_t i;
+
+  memset(&power_statistics, 0, sizeof(power_statistics));
+  for (i = 0; i < SL_POWER_MANAGER_STATISTICS_WAKEUP_SOURCE_COUNT; i++) {
+    power_statistics.wakeup_source[i].irqn = -1;
+  }
+  power_statistics_em_entry_tick = sl_sleeptimer_get_tick_count64();
+}
+
+/***************************************************************************//**
+ * Accumulate the time spent in the energy mode that is being left.
+ *
+ * @param from  Energy mode left.
+ *
+ * @param to    Energy mode entered.
+ ******************************************************************************/
+static void power_manager_statistics_on_em_transition(sl_power_manager_em_t from,
+                                                      sl_power_manager_em_t to)
+{
+  uint64_t now = sl_sleeptimer_get_tick_count64();
+
+  if (from <= SL_POWER_MANAGER_EM2) {
+    power_statistics.em_residency_tick[from] += now - power_statistics_em_entry_tick;
+  }
+  power_statistics_em_entry_tick = now;
+  power_statistics_em = to;
+}
+
+/***************************************************************************//**
+ * Initialize the energy mode statistics.
+ ******************************************************************************/
+void sli_power_manager_statistics_init(void)
+{
+  power_manager_statistics_clear();
+  sl_power_manager_subscribe_em_transition_event(&power_statistics_event_handle,
+                                                 &power_statistics_event_info);
+}
+
+/***************************************************************************//**
+ * Record a sleep rejected by sl_power_manager_is_ok_to_sleep().
+ ******************************************************************************/
+void sli_power_manager_statistics_on_sleep_rejected(void)
+{
+  power_statistics.sleep_rejected_count++;
+}
+
+/***************************************************************************//**
+ * Record a sleep in the given energy mode.
+ ******************************************************************************/
+void sli_power_manager_statistics_on_sleep(sl_power_manager_em_t em,
+                                           bool is_em1_offtime_only)
+{
+  power_statistics.sleep_count++;
+  if (em == SL_POWER_MANAGER_EM1) {
+    if (is_em1_offtime_only) {
+      power_statistics.em1_min_offtime_count++;
+    } else {
+      power_statistics.em1_requirement_count++;
+    }
+  }
+}
+
+/***************************************************************************//**
+ * Record the interrupt that woke up the core.
+ *
+ * The pending interrupt with the lowest number is taken as the wake-up source.
+ ******************************************************************************/
+void sli_power_manager_statistics_on_wakeup(void)
+{
+  uint32_t word;
+  uint32_t pending;
+  int16_t irqn = -1;
+  uint32_t i;
+
+  for (word = 0; word < ((EXT_IRQ_COUNT + 31U) / 32U); word++) {
+    pending = NVIC->ISPR[word] & NVIC->ISER[word];
+    if (pending != 0U) {
+      irqn = (int16_t)((word * 32U) + __CLZ(__RBIT(pending)));
+      break;
+    }
+  }
+
+  if (irqn >= 0) {
+    for (i = 0; i < SL_POWER_MANAGER_STATISTICS_WAKEUP_SOURCE_COUNT; i++) {
+      if (power_statistics.wakeup_source[i].irqn == -1) {
+        power_statistics.wakeup_source[i].irqn = irqn;
+      }
+      if (power_statistics.wakeup_source[i].irqn == irqn) {
+        power_statistics.wakeup_source[i].count++;
+        return;
+      }
+    }
+  }
+  power_statistics.wakeup_unknown_count++;
+}
+
+/***************************************************************************//**
+ * Get the energy mode statistics.
+ ******************************************************************************/
+void sl_power_manager_get_statistics(sl_power_manager_statistics_t *statistics)
+{
+  CORE_DECLARE_IRQ_STATE;
+
+  CORE_ENTER_CRITICAL();
+  *statistics = power_statistics;
+  if (power_statistics_em <= SL_POWER_MANAGER_EM2) {
+    statistics->em_residency_tick[power_statistics_em] += sl_sleeptimer_get_tick_count64() - power_statistics_em_entry_tick;
+  }
+  CORE_EXIT_CRITICAL();
+}
+
+/***************************************************************************//**
+ * Reset the energy mode statistics.
+ ******************************************************************************/
+void sl_power_manager_reset_statistics(void)
+{
+  CORE_DECLARE_IRQ_STATE;
+
+  CORE_ENTER_CRITICAL();
+  power_manager_statistics_clear();
+  CORE_EXIT_CRITICAL();
+}
+#endif // SL_POWER_MANAGER_STATISTICS
+
 #undef sli_power_manager_debug_log_em_requirement
 /***************************************************************************//**
  * Log energy mode (EM) requirement
@@ -29,6 +29,7 @@
  ******************************************************************************/
 
 #include "sl_power_manager.h"
+#include "sl_power_manager_config.h"
 #include "sl_slist.h"
 #include "sl_code_classification.h"
 
@@ -81,6 +82,48 @@ void sli_power_manager_apply_em(sl_power_manager_em_t em);
 
 void sli_power_manager_debug_init(void);
 
+#if (SL_POWER_MANAGER_STATISTICS == 1)
+/*******************************************************************************
+ * Initializes the energy mode statistics.
+ *
+ * @note Must be called after the energy mode transition list is initialized.
+ ******************************************************************************/
+void sli_power_manager_statistics_init(void);
+
+/*******************************************************************************
+ * Records a sleep rejected by sl_power_manager_is_ok_to_sleep().
+ ******************************************************************************/
+SL_CODE_CLASSIFY(SL_CODE_COMPONENT_POWER_MANAGER, SL_CODE_CLASS_TIME_CRITICAL)
+void sli_power_manager_statistics_on_sleep_rejected(void);
+
+/*******************************************************************************
+ * Records a sleep in the given energy mode.
+ *
+ * @param em                  Lowest energy mode allowed by the requirements.
+ *
+ * @param is_em1_offtime_only True if the only EM1 requirement is the one added
+ *                            internally because the next timer is too close.
+ *
+ * @note Must be called in a critical section.
+ ******************************************************************************/
+SL_CODE_CLASSIFY(SL_CODE_COMPONENT_POWER_MANAGER, SL_CODE_CLASS_TIME_CRITICAL)
+void sli_power_manager_statistics_on_sleep(sl_power_manager_em_t em,
+                                           bool is_em1_offtime_only);
+
+/*******************************************************************************
+ * Records the interrupt that woke up the core.
+ *
+ * @note Must be called with interrupts masked, right after the core wakes up.
+ ******************************************************************************/
+SL_CODE_CLASSIFY(SL_CODE_COMPONENT_POWER_MANAGER, SL_CODE_CLASS_TIME_CRITICAL)
+void sli_power_manager_statistics_on_wakeup(void);
+#else
+#define sli_power_manager_statistics_init()
+#define sli_power_manager_statistics_on_sleep_rejected()
+#define sli_power_manager_statistics_on_sleep(em, is_em1_offtime_only)
+#define sli_power_manager_statistics_on_wakeup()
+#endif
+
 #if !defined(SL_CATALOG_POWER_MANAGER_NO_DEEPSLEEP_PRESENT)
 SL_CODE_CLASSIFY(SL_CODE_COMPONENT_POWER_MANAGER, SL_CODE_CLASS_TIME_CRITICAL)
 void sli_power_manager_save_states(void);
@@ -30,6 +30,9 @@
 #ifndef _SL_MAIN_INIT_H
 #define _SL_MAIN_INIT_H
 
+#include <stdint.h>
+#include "sl_main_boot_trace_config.h"
+
 /***************************************************************************//**
  * @addtogroup sl_main System Setup (sl_main)
  * @brief System Setup (sl_main)
@@ -96,6 +99,15 @@
  * is called. If an RTOS is included in the project the sl_main_second_stage_init
  * function will be called after the OS kernel is started.
  *
+ * ### Boot Trace
+ *
+ * When \a SL_MAIN_BOOT_TRACE_ENABLED is set in \b sl_main_boot_trace_config.h,
+ * sl_main_init() and sl_main_second_stage_init() record the DWT cycle counter
+ * and the core clock frequency after every initialization step. Other
+ * components can add their own steps with SL_MAIN_BOOT_TRACE(). The trace can
+ * be read with sl_main_boot_trace_get() once the device has booted. The trace
+ * only covers the current boot, it is not kept across resets.
+ *
  * ### Main Kernel
  *
  * Main Kernel component provides an API to:
@@ -287,6 +299,37 @@ void sl_main_init(void);
  *****************************************************************************/
 void sl_main_second_stage_init(void);
 
+#if (SL_MAIN_BOOT_TRACE_ENABLED == 1)
+/// One step of the boot trace.
+typedef struct {
+  const char *step;        ///< Name of the step that just completed.
+  uint32_t cycles;         ///< DWT cycle counter when the step completed.
+  uint32_t core_clock_hz;  ///< Core clock frequency when the step completed.
+} sl_main_boot_trace_entry_t;
+
+/******************************************************************************
+ * @brief Record the completion of an initialization step.
+ *
+ * @param[in] step  Name of the step. Must point to a string with static storage.
+ *****************************************************************************/
+void sl_main_boot_trace(const char *step);
+
+/******************************************************************************
+ * @brief Get the boot trace.
+ *
+ * @param[out] count    Number of entries stored in the trace.
+ * @param[out] dropped  Number of steps that did not fit in the trace. Can be NULL.
+ *
+ * @return A pointer to the first entry of the trace.
+ *****************************************************************************/
+const sl_main_boot_trace_entry_t *sl_main_boot_trace_get(uint8_t *count,
+                                                         uint8_t *dropped);
+
+#define SL_MAIN_BOOT_TRACE(step)  sl_main_boot_trace(step)
+#else
+#define SL_MAIN_BOOT_TRACE(step)
+#endif // SL_MAIN_BOOT_TRACE_ENABLED
+
 #ifdef __cplusplus
 }
 #endif
@@ -51,6 +51,67 @@ extern "C" {
  *****************************************************************************/
 void sl_main_process_action(void);
 
+// Profiling is only declared for translation units that include
+// sl_main_process_action_config.h before this header.
+#if defined(SL_MAIN_PROCESS_ACTION_PROFILING) && (SL_MAIN_PROCESS_ACTION_PROFILING == 1)
+#include <stdbool.h>
+#include <stdint.h>
+#include "sl_slist.h"
+
+/// Number of histogram buckets; bucket n counts durations in [2^n, 2^(n+1)) cycles.
+#define SL_MAIN_PROCESS_ACTION_PROFILE_BUCKETS  32
+
+/// Timing statistics for one process action.
+typedef struct {
+  sl_slist_node_t node;           ///< Profile list node.
+  bool registered;                ///< Profile is in the profile list.
+  const char *name;               ///< Process action name.
+  uint32_t count;                 ///< Number of calls.
+  uint32_t last_cycles;           ///< Cycles spent in the last call.
+  uint32_t max_cycles;            ///< Largest number of cycles spent in one call.
+  uint32_t over_budget_count;     ///< Calls exceeding SL_MAIN_PROCESS_ACTION_BUDGET_CYCLES.
+  uint16_t histogram[SL_MAIN_PROCESS_ACTION_PROFILE_BUCKETS]; ///< Cycle count histogram, halved when a bucket saturates.
+} sl_main_process_action_profile_t;
+
+/******************************************************************************
+ * @brief Time a process action and record it in its profile.
+ *
+ * @param[in] action  Process action function taking no arguments.
+ *
+ * @note Used by sl_main_process_action() around each process action phase.
+ *       The profile is registered the first time the action runs.
+ *****************************************************************************/
+#define SL_MAIN_PROFILE_PROCESS_ACTION(action)                                      \
+  do {                                                                              \
+    static sl_main_process_action_profile_t action##_profile = { .name = #action }; \
+    uint32_t action##_start = sli_main_process_action_profile_start();              \
+    action();                                                                       \
+    sli_main_process_action_profile_stop(&action##_profile, action##_start);        \
+  } while (0)
+
+/// @cond DO_NOT_INCLUDE_WITH_DOXYGEN
+uint32_t sli_main_process_action_profile_start(void);
+void sli_main_process_action_profile_stop(sl_main_process_action_profile_t *profile,
+                                          uint32_t start);
+/// @endcond
+
+/******************************************************************************
+ * @brief Get the next process action profile.
+ *
+ * @param[in] profile  Previous profile, or NULL to get the first one.
+ *
+ * @return The next profile, or NULL when all profiles have been returned.
+ *****************************************************************************/
+const sl_main_process_action_profile_t *sl_main_process_action_profile_get_next(const sl_main_process_action_profile_t *profile);
+
+/******************************************************************************
+ * @brief Clear the statistics of all process action profiles.
+ *****************************************************************************/
+void sl_main_process_action_profile_reset(void);
+#else
+#define SL_MAIN_PROFILE_PROCESS_ACTION(action)  action()
+#endif // SL_MAIN_PROCESS_ACTION_PROFILING
+
 #ifdef __cplusplus
 }
 #endif
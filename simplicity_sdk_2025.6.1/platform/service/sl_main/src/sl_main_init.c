@@ -126,6 +126,64 @@
 #include "hal.h"
 #endif
 
+#if (SL_MAIN_BOOT_TRACE_ENABLED == 1)
+#include "em_device.h"
+
+// The trace only covers the current boot. It is restarted by every call to
+// sl_main_init().
+static sl_main_boot_trace_entry_t boot_trace[SL_MAIN_BOOT_TRACE_SIZE];
+static uint8_t boot_trace_count;
+static uint8_t boot_trace_dropped;
+
+/******************************************************************************
+ * Start a new boot trace.
+ *****************************************************************************/
+static void boot_trace_start(void)
+{
+  CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+  DWT->CYCCNT = 0;
+  DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+  boot_trace_count = 0;
+  boot_trace_dropped = 0;
+  sl_main_boot_trace("reset");
+}
+
+/******************************************************************************
+ * Record the completion of an initialization step.
+ *****************************************************************************/
+void sl_main_boot_trace(const char *step)
+{
+  if (boot_trace_count >= SL_MAIN_BOOT_TRACE_SIZE) {
+    if (boot_trace_dropped < UINT8_MAX) {
+      boot_trace_dropped++;
+    }
+    return;
+  }
+  // The clock setup may turn the trace unit off while switching oscillators.
+  if ((DWT->CTRL & DWT_CTRL_CYCCNTENA_Msk) == 0U) {
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+  }
+  boot_trace[boot_trace_count].step = step;
+  boot_trace[boot_trace_count].cycles = DWT->CYCCNT;
+  boot_trace[boot_trace_count].core_clock_hz = SystemCoreClock;
+  boot_trace_count++;
+}
+
+/******************************************************************************
+ * Get the boot trace.
+ *****************************************************************************/
+const sl_main_boot_trace_entry_t *sl_main_boot_trace_get(uint8_t *count,
+                                                         uint8_t *dropped)
+{
+  *count = boot_trace_count;
+  if (dropped != NULL) {
+    *dropped = boot_trace_dropped;
+  }
+  return boot_trace;
+}
+#endif // SL_MAIN_BOOT_TRACE_ENABLED
+
 /******************************************************************************
  * @brief User-defined function for pre-clock app initialization.
  *
@@ -191,10 +249,15 @@ __WEAK void app_process_action(void)
 void sl_main_second_stage_init(void)
 {
   sl_platform_init();
+  SL_MAIN_BOOT_TRACE("platform_init");
   sl_driver_init();
+  SL_MAIN_BOOT_TRACE("driver_init");
   sl_service_init();
+  SL_MAIN_BOOT_TRACE("service_init");
   sl_stack_init();
+  SL_MAIN_BOOT_TRACE("stack_init");
   sl_internal_app_init();
+  SL_MAIN_BOOT_TRACE("internal_app_init");
 #if defined(SL_CATALOG_KERNEL_PRESENT) && (SL_MAIN_ENABLE_START_TASK_PRIORITY_CHANGE == 1)
   osThreadSetPriority(osThreadGetId(), SL_MAIN_START_TASK_PRIORITY);
 #endif
@@ -210,6 +273,10 @@ void sl_main_second_stage_init(void)
  *****************************************************************************/
 void sl_main_init(void)
 {
+#if (SL_MAIN_BOOT_TRACE_ENABLED == 1)
+  boot_trace_start();
+#endif
+
 #if defined(SL_CATALOG_MEMORY_MANAGER_PRESENT) && !defined(SL_CATALOG_CPP_SUPPORT_PRESENT)
   sl_memory_init();
 #endif
@@ -220,6 +287,7 @@ void sl_main_init(void)
 
   // Pre-clock application initialization.
   app_init_pre_clock();
+  SL_MAIN_BOOT_TRACE("app_init_pre_clock");
 
 #if defined(SL_CATALOG_INTERRUPT_MANAGER_PRESENT)
   sl_interrupt_manager_init();
@@ -264,6 +332,7 @@ void sl_main_init(void)
 #if defined(SL_CATALOG_CLOCK_MANAGER_PRESENT)
   sl_clock_manager_init();
 #endif
+  SL_MAIN_BOOT_TRACE("clocks");
 
 #if defined(SL_SI91X_SOC_MODE)
   SystemCoreClockUpdate();
@@ -276,6 +345,7 @@ void sl_main_init(void)
 #if defined(SL_CATALOG_POWER_MANAGER_PRESENT)
   sl_power_manager_init();
 #endif
+  SL_MAIN_BOOT_TRACE("emu_power_manager");
 
 #if defined(SL_CATALOG_SLEEPTIMER_PRESENT)
   sl_sleeptimer_init();
@@ -289,11 +359,15 @@ void sl_main_init(void)
   sl_mpu_disable_execute_from_ram();
 #endif
 
+  SL_MAIN_BOOT_TRACE("sleeptimer");
+
   // Early application initialization (post-system init).
   app_init_early();
+  SL_MAIN_BOOT_TRACE("app_init_early");
 
 #ifdef SL_CATALOG_LEGACY_HAL_SOC_PRESENT
   halInit();
+  SL_MAIN_BOOT_TRACE("hal_init");
 #endif
 
 #if defined(SL_CATALOG_KERNEL_PRESENT)
@@ -301,9 +375,11 @@ void sl_main_init(void)
 #endif
 
   sli_allocate_permanent_memory();
+  SL_MAIN_BOOT_TRACE("permanent_memory");
 
   // Internal early init event.
   sli_internal_init_early();
+  SL_MAIN_BOOT_TRACE("internal_init_early");
 
 #if defined(SL_CATALOG_KERNEL_PRESENT)
   sli_main_kernel_start_task_initialize();
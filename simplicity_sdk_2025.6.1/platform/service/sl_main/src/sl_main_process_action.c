@@ -28,6 +28,93 @@
  *
  ******************************************************************************/
 #include "sl_event_handler.h"
+#include "sl_main_process_action_config.h"
+#include "sl_main_process_action.h"
+
+#if (SL_MAIN_PROCESS_ACTION_PROFILING == 1)
+#include <string.h>
+#include "em_device.h"
+#include "sl_core.h"
+
+static sl_slist_node_t *profile_list;
+
+/******************************************************************************
+ * Start timing a process action.
+ *****************************************************************************/
+uint32_t sli_main_process_action_profile_start(void)
+{
+  // The cycle counter may be left disabled by the clock setup, so make sure
+  // it runs before sampling it.
+  if ((DWT->CTRL & DWT_CTRL_CYCCNTENA_Msk) == 0U) {
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+  }
+  return DWT->CYCCNT;
+}
+
+/******************************************************************************
+ * Stop timing a process action and update its profile.
+ *****************************************************************************/
+void sli_main_process_action_profile_stop(sl_main_process_action_profile_t *profile,
+                                          uint32_t start)
+{
+  uint32_t cycles = DWT->CYCCNT - start;
+  uint8_t bucket = 0;
+
+  if (!profile->registered) {
+    profile->registered = true;
+    sl_slist_push_back(&profile_list, &profile->node);
+  }
+
+  profile->count++;
+  profile->last_cycles = cycles;
+  if (cycles > profile->max_cycles) {
+    profile->max_cycles = cycles;
+  }
+#if (SL_MAIN_PROCESS_ACTION_BUDGET_CYCLES > 0)
+  if (cycles > SL_MAIN_PROCESS_ACTION_BUDGET_CYCLES) {
+    profile->over_budget_count++;
+  }
+#endif
+
+  while ((cycles >>= 1) != 0U) {
+    bucket++;
+  }
+  if (profile->histogram[bucket] == UINT16_MAX) {
+    // Halve all buckets so the histogram keeps following recent behavior.
+    for (uint8_t i = 0; i < SL_MAIN_PROCESS_ACTION_PROFILE_BUCKETS; i++) {
+      profile->histogram[i] >>= 1;
+    }
+  }
+  profile->histogram[bucket]++;
+}
+
+/******************************************************************************
+ * Get the next process action profile.
+ *****************************************************************************/
+const sl_main_process_action_profile_t *sl_main_process_action_profile_get_next(const sl_main_process_action_profile_t *profile)
+{
+  sl_slist_node_t *node = (profile == NULL) ? profile_list : profile->node.node;
+
+  return (node == NULL) ? NULL : SL_SLIST_ENTRY(node, sl_main_process_action_profile_t, node);
+}
+
+/******************************************************************************
+ * Clear the statistics of all process action profiles.
+ *****************************************************************************/
+void sl_main_process_action_profile_reset(void)
+{
+  sl_main_process_action_profile_t *profile;
+
+  SL_SLIST_FOR_EACH_ENTRY(profile_list, profile, sl_main_process_action_profile_t, node) {
+    profile->count = 0;
+    profile->last_cycles = 0;
+    profile->max_cycles = 0;
+    profile->over_budget_count = 0;
+    memset(profile->histogram, 0, sizeof(profile->histogram));
+  }
+}
+#endif // SL_MAIN_PROCESS_ACTION_PROFILING
 
 /******************************************************************************
  * @brief Action(s) to perform periodically from the main loop.
@@ -41,8 +128,8 @@
  *****************************************************************************/
 void sl_main_process_action(void)
 {
-  sli_platform_process_action();
-  sli_service_process_action();
-  sli_stack_process_action();
-  sli_internal_app_process_action();
+  SL_MAIN_PROFILE_PROCESS_ACTION(sli_platform_process_action);
+  SL_MAIN_PROFILE_PROCESS_ACTION(sli_service_process_action);
+  SL_MAIN_PROFILE_PROCESS_ACTION(sli_stack_process_action);
+  SL_MAIN_PROFILE_PROCESS_ACTION(sli_internal_app_process_action);
 }
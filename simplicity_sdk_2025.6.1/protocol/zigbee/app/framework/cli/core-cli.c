@@ -30,6 +30,15 @@
   #include "stack/include/cbke-crypto-engine.h"  // sl_zigbee_get_certificate()
 #endif
 
+#ifdef SL_CATALOG_SL_MAIN_PRESENT
+#include "sl_main_init.h"
+#include "sl_main_process_action_config.h"
+#include "sl_main_process_action.h"
+#endif
+#ifdef SL_CATALOG_POWER_MANAGER_PRESENT
+#include "sl_power_manager_debug.h"
+#include "sl_sleeptimer.h"
+#endif
 #ifdef SL_CATALOG_KERNEL_PRESENT
 #include "cmsis_os2.h"
 #include "sl_cmsis_os2_common.h"
@@ -439,3 +448,216 @@ void printEvents(sl_cli_command_arg_t *arguments)
   sl_zigbee_core_debug_print("Enable event debug info in Core CLI component");
 #endif // SL_ZIGBEE_EVENT_DEBUG_ENABLED
 }
+
+void printEventProfile(sl_cli_command_arg_t *arguments)
+{
+  (void)arguments;
+#if SL_ZIGBEE_EVENT_PROFILER_ENABLED
+  const sli_zigbee_event_profile_t *profile;
+  uint8_t i;
+
+  sl_zigbee_core_debug_println("Event : runs : avg/p99<=/max us : p99<=/max late ms");
+  for (i = 0; (profile = sli_zigbee_event_profiler_get(i)) != NULL; i++) {
+    sl_zigbee_core_debug_println("%s : %d : %d/%d/%d : %d/%d",
+                                 (profile->event->actions.name == NULL
+                                  ? "?"
+                                  : profile->event->actions.name),
+                                 profile->run_count,
+                                 (profile->run_count == 0
+                                  ? 0
+                                  : profile->total_run_us / profile->run_count),
+                                 sli_zigbee_event_profiler_percentile(profile->run_us_histogram, 99,
+                                                                       profile->max_run_us),
+                                 profile->max_run_us,
+                                 sli_zigbee_event_profiler_percentile(profile->late_ms_histogram, 99,
+                                                                       profile->max_late_ms),
+                                 profile->max_late_ms);
+  }
+  if (sli_zigbee_event_profiler_get_dropped() > 0) {
+    sl_zigbee_core_debug_println("%d dispatches not profiled, table full",
+                                 sli_zigbee_event_profiler_get_dropped());
+  }
+#else
+  sl_zigbee_core_debug_print("Enable the event profiler in its component configuration");
+#endif // SL_ZIGBEE_EVENT_PROFILER_ENABLED
+}
+
+void resetEventProfile(sl_cli_command_arg_t *arguments)
+{
+  (void)arguments;
+#if SL_ZIGBEE_EVENT_PROFILER_ENABLED
+  sli_zigbee_event_profiler_reset();
+#else
+  sl_zigbee_core_debug_print("Enable the event profiler in its component configuration");
+#endif // SL_ZIGBEE_EVENT_PROFILER_ENABLED
+}
+
+void printBootTrace(sl_cli_command_arg_t *arguments)
+{
+  (void)arguments;
+#if defined(SL_CATALOG_SL_MAIN_PRESENT) && (SL_MAIN_BOOT_TRACE_ENABLED == 1)
+  const sl_main_boot_trace_entry_t *trace;
+  uint8_t count;
+  uint8_t dropped;
+  uint8_t i;
+  uint32_t step_us;
+  uint32_t total_us = 0;
+
+  trace = sl_main_boot_trace_get(&count, &dropped);
+  sl_zigbee_core_debug_println("Step : step us : total us");
+  for (i = 1; i < count; i++) {
+    // Convert with the clock of the step itself, the core clock is switched
+    // during initialization.
+    uint32_t mhz = trace[i].core_clock_hz / 1000000UL;
+    if (mhz == 0) {
+      mhz = 1;
+    }
+    step_us = (trace[i].cycles - trace[i - 1].cycles) / mhz;
+    total_us += step_us;
+    sl_zigbee_core_debug_println("%s : %d : %d", trace[i].step, step_us, total_us);
+  }
+  if (dropped > 0) {
+    sl_zigbee_core_debug_println("%d steps not recorded, trace full", dropped);
+  }
+#else
+  sl_zigbee_core_debug_print("Enable the boot trace in sl_main_boot_trace_config.h");
+#endif // SL_MAIN_BOOT_TRACE_ENABLED
+}
+
+void printProcessActionProfile(sl_cli_command_arg_t *arguments)
+{
+  (void)arguments;
+#if defined(SL_CATALOG_SL_MAIN_PRESENT) && (SL_MAIN_PROCESS_ACTION_PROFILING == 1)
+  const sl_main_process_action_profile_t *profile = NULL;
+  const sl_main_process_action_profile_t *worst = NULL;
+
+  sl_zigbee_core_debug_println("Action : calls : last/max cycles : over budget");
+  while ((profile = sl_main_process_action_profile_get_next(profile)) != NULL) {
+    sl_zigbee_core_debug_println("%s : %d : %d/%d : %d",
+                                 profile->name,
+                                 profile->count,
+                                 profile->last_cycles,
+                                 profile->max_cycles,
+                                 profile->over_budget_count);
+    if (worst == NULL || profile->max_cycles > worst->max_cycles) {
+      worst = profile;
+    }
+  }
+  if (worst != NULL) {
+    sl_zigbee_core_debug_println("Longest: %s, %d cycles", worst->name, worst->max_cycles);
+  }
+#else
+  sl_zigbee_core_debug_print("Enable profiling in sl_main_process_action_config.h");
+#endif // SL_MAIN_PROCESS_ACTION_PROFILING
+}
+
+void resetProcessActionProfile(sl_cli_command_arg_t *arguments)
+{
+  (void)arguments;
+#if defined(SL_CATALOG_SL_MAIN_PRESENT) && (SL_MAIN_PROCESS_ACTION_PROFILING == 1)
+  sl_main_process_action_profile_reset();
+#else
+  sl_zigbee_core_debug_print("Enable profiling in sl_main_process_action_config.h");
+#endif // SL_MAIN_PROCESS_ACTION_PROFILING
+}
+
+#if defined(SL_CATALOG_POWER_MANAGER_PRESENT) && (SL_POWER_MANAGER_STATISTICS == 1)
+static uint32_t powerTicksToMs(uint64_t ticks)
+{
+  uint64_t ms = 0;
+
+  (void)sl_sleeptimer_tick64_to_ms(ticks, &ms);
+  return (ms > UINT32_MAX) ? UINT32_MAX : (uint32_t)ms;
+}
+#endif
+
+void printPowerStatistics(sl_cli_command_arg_t *arguments)
+{
+  (void)arguments;
+#if defined(SL_CATALOG_POWER_MANAGER_PRESENT) && (SL_POWER_MANAGER_STATISTICS == 1)
+  sl_power_manager_statistics_t stats;
+  uint64_t totalTicks;
+  uint8_t em;
+  uint8_t i;
+
+  sl_power_manager_get_statistics(&stats);
+  totalTicks = stats.em_residency_tick[SL_POWER_MANAGER_EM0]
+               + stats.em_residency_tick[SL_POWER_MANAGER_EM1]
+               + stats.em_residency_tick[SL_POWER_MANAGER_EM2];
+  for (em = SL_POWER_MANAGER_EM0; em <= SL_POWER_MANAGER_EM2; em++) {
+    sl_zigbee_core_debug_println("EM%d : %d ms : %d%%",
+                                 em,
+                                 powerTicksToMs(stats.em_residency_tick[em]),
+                                 (totalTicks == 0
+                                  ? 0
+                                  : (uint32_t)((stats.em_residency_tick[em] * 100) / totalTicks)));
+  }
+  sl_zigbee_core_debug_println("Sleeps : %d", stats.sleep_count);
+  sl_zigbee_core_debug_println("Rejected by is_ok_to_sleep : %d", stats.sleep_rejected_count);
+  sl_zigbee_core_debug_println("Limited to EM1 by requirement : %d", stats.em1_requirement_count);
+  sl_zigbee_core_debug_println("Limited to EM1 by min offtime : %d", stats.em1_min_offtime_count);
+  sl_zigbee_core_debug_println("Wakeup IRQ : count");
+  for (i = 0; i < SL_POWER_MANAGER_STATISTICS_WAKEUP_SOURCE_COUNT; i++) {
+    if (stats.wakeup_source[i].irqn >= 0) {
+      sl_zigbee_core_debug_println("%d : %d",
+                                   stats.wakeup_source[i].irqn,
+                                   stats.wakeup_source[i].count);
+    }
+  }
+  sl_zigbee_core_debug_println("other : %d", stats.wakeup_unknown_count);
+#else
+  sl_zigbee_core_debug_print("Enable the statistics in Power Manager component");
+#endif // SL_POWER_MANAGER_STATISTICS
+}
+
+void resetPowerStatistics(sl_cli_command_arg_t *arguments)
+{
+  (void)arguments;
+#if defined(SL_CATALOG_POWER_MANAGER_PRESENT) && (SL_POWER_MANAGER_STATISTICS == 1)
+  sl_power_manager_reset_statistics();
+#else
+  sl_zigbee_core_debug_print("Enable the statistics in Power Manager component");
+#endif // SL_POWER_MANAGER_STATISTICS
+}
+
+void printSleepLog(sl_cli_command_arg_t *arguments)
+{
+  (void)arguments;
+#if SL_ZIGBEE_SLEEP_TELEMETRY_ENABLED
+  const sli_zigbee_sleep_decision_t *decision;
+  uint8_t i;
+
+  for (i = 0; i < SLI_ZIGBEE_SLEEP_REASON_COUNT; i++) {
+    sl_zigbee_core_debug_println("%s : %d",
+                                 sli_zigbee_sleep_telemetry_reason_name(i),
+                                 sli_zigbee_sleep_telemetry_get_count(i));
+  }
+  sl_zigbee_core_debug_println("Time ms : source : reason : repeats : next wakeup ms : slept ms : next event");
+  for (i = 0; (decision = sli_zigbee_sleep_telemetry_get(i)) != NULL; i++) {
+    sl_zigbee_core_debug_println("%d : %s : %s : %d : %d : %d : %s",
+                                 decision->timestamp_ms,
+                                 (decision->source == SLI_ZIGBEE_SLEEP_SOURCE_STACK
+                                  ? "stack"
+                                  : "app"),
+                                 sli_zigbee_sleep_telemetry_reason_name(decision->reason),
+                                 decision->repeat_count,
+                                 decision->ms_to_next_wakeup,
+                                 decision->slept_ms,
+                                 (decision->next_event == NULL
+                                  ? "-"
+                                  : decision->next_event));
+  }
+#else
+  sl_zigbee_core_debug_print("Enable sleep telemetry in Zigbee sleep configuration");
+#endif // SL_ZIGBEE_SLEEP_TELEMETRY_ENABLED
+}
+
+void resetSleepLog(sl_cli_command_arg_t *arguments)
+{
+  (void)arguments;
+#if SL_ZIGBEE_SLEEP_TELEMETRY_ENABLED
+  sli_zigbee_sleep_telemetry_reset();
+#else
+  sl_zigbee_core_debug_print("Enable sleep telemetry in Zigbee sleep configuration");
+#endif // SL_ZIGBEE_SLEEP_TELEMETRY_ENABLED
+}
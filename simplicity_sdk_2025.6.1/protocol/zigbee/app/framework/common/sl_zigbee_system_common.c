@@ -28,6 +28,10 @@
 #endif
 #include "sl_code_classification.h"
 
+#if defined(SL_CATALOG_SL_MAIN_PRESENT)
+#include "sl_main_init.h"
+#endif // SL_CATALOG_SL_MAIN_PRESENT
+
 #if (defined(SL_CATALOG_ZIGBEE_ZCL_FRAMEWORK_CORE_PRESENT) || (defined(SL_ZIGBEE_SCRIPTED_TEST))) \
   || (defined(SL_ZIGBEE_AF_NCP) && defined(SL_CATALOG_ZIGBEE_AF_SUPPORT_PRESENT))
 extern sl_status_t sl_zigbee_af_push_network_index(uint8_t networkIndex);
@@ -107,11 +111,23 @@ void sli_zigbee_app_framework_init_callback(void)
 
   // Call the application init callback.
   sl_zigbee_af_main_init_cb();
+#if defined(SL_CATALOG_SL_MAIN_PRESENT)
+  SL_MAIN_BOOT_TRACE("zigbee_af_main_init");
+#endif
 
   // Call the generated init callbacks.
   sli_zigbee_af_event_init();
+#if defined(SL_CATALOG_SL_MAIN_PRESENT)
+  SL_MAIN_BOOT_TRACE("zigbee_af_event_init");
+#endif
   sli_zigbee_af_local_data_init();
+#if defined(SL_CATALOG_SL_MAIN_PRESENT)
+  SL_MAIN_BOOT_TRACE("zigbee_af_local_data_init");
+#endif
   sli_zigbee_af_init_done();
+#if defined(SL_CATALOG_SL_MAIN_PRESENT)
+  SL_MAIN_BOOT_TRACE("zigbee_af_init_done");
+#endif
 
 #if defined(EXTENDED_RESET_INFO)
   #ifndef SL_CATALOG_ZIGBEE_ZCL_FRAMEWORK_CORE_PRESENT
@@ -167,8 +183,271 @@ void sli_zigbee_app_framework_tick_callback(void)
 //------------------------------------------------------------------------------
 // Event System
 
+#if SL_ZIGBEE_EVENT_PROFILER_ENABLED
+#if defined(SL_CATALOG_SLEEPTIMER_PRESENT)
+#include "sl_sleeptimer.h"
+#endif
+
+static sli_zigbee_event_profile_t event_profiles[SL_ZIGBEE_EVENT_PROFILER_TABLE_SIZE];
+static uint8_t event_profile_count;
+static uint32_t event_profile_dropped;
+
+// Timestamp used to measure handler runtime. The sleeptimer gives ~30 us
+// resolution; hosts without it fall back to the millisecond tick. Durations
+// are taken as unsigned tick differences so they survive a tick wrap, and
+// only the difference is converted to microseconds.
+static uint32_t event_profiler_get_tick(void)
+{
+#if defined(SL_CATALOG_SLEEPTIMER_PRESENT)
+  return sl_sleeptimer_get_tick_count();
+#else
+  return halCommonGetInt32uMillisecondTick();
+#endif
+}
+
+static uint32_t event_profiler_elapsed_us(uint32_t start_tick)
+{
+  uint32_t ticks = event_profiler_get_tick() - start_tick;
+  uint64_t us;
+
+#if defined(SL_CATALOG_SLEEPTIMER_PRESENT)
+  us = ((uint64_t)ticks * 1000000u) / sl_sleeptimer_get_timer_frequency();
+#else
+  us = (uint64_t)ticks * 1000u;
+#endif
+  return (us < UINT32_MAX) ? (uint32_t)us : UINT32_MAX;
+}
+
+static uint8_t event_profiler_bucket(uint32_t value)
+{
+  uint8_t bucket = 0;
+
+  while (value != 0 && bucket < SLI_ZIGBEE_EVENT_PROFILER_BUCKETS - 1) {
+    value >>= 1;
+    bucket++;
+  }
+  return bucket;
+}
+
+static void event_profiler_record(const sl_zigbee_af_event_t *event,
+                                  uint32_t late_ms,
+                                  uint32_t run_us)
+{
+  sli_zigbee_event_profile_t *profile = NULL;
+  uint8_t i;
+
+  for (i = 0; i < event_profile_count; i++) {
+    if (event_profiles[i].event == event) {
+      profile = &event_profiles[i];
+      break;
+    }
+  }
+  if (profile == NULL) {
+    if (event_profile_count == SL_ZIGBEE_EVENT_PROFILER_TABLE_SIZE) {
+      event_profile_dropped++;
+      return;
+    }
+    profile = &event_profiles[event_profile_count++];
+    profile->event = event;
+  }
+
+  // Saturate rather than wrap so that long runs still give sane averages.
+  if (profile->run_count < UINT32_MAX
+      && profile->total_run_us <= UINT32_MAX - run_us) {
+    profile->run_count++;
+    profile->total_run_us += run_us;
+  }
+  if (run_us > profile->max_run_us) {
+    profile->max_run_us = run_us;
+  }
+  if (late_ms > profile->max_late_ms) {
+    profile->max_late_ms = late_ms;
+  }
+  i = event_profiler_bucket(run_us);
+  if (profile->run_us_histogram[i] < UINT16_MAX) {
+    profile->run_us_histogram[i]++;
+  }
+  i = event_profiler_bucket(late_ms);
+  if (profile->late_ms_histogram[i] < UINT16_MAX) {
+    profile->late_ms_histogram[i]++;
+  }
+}
+
+const sli_zigbee_event_profile_t *sli_zigbee_event_profiler_get(uint8_t index)
+{
+  return (index < event_profile_count) ? &event_profiles[index] : NULL;
+}
+
+uint32_t sli_zigbee_event_profiler_get_dropped(void)
+{
+  return event_profile_dropped;
+}
+
+uint32_t sli_zigbee_event_profiler_percentile(const uint16_t *histogram,
+                                              uint8_t percent,
+                                              uint32_t max)
+{
+  uint32_t bound;
+  uint32_t total = 0;
+  uint32_t count = 0;
+  uint8_t i;
+
+  for (i = 0; i < SLI_ZIGBEE_EVENT_PROFILER_BUCKETS; i++) {
+    total += histogram[i];
+  }
+  for (i = 0; i < SLI_ZIGBEE_EVENT_PROFILER_BUCKETS; i++) {
+    count += histogram[i];
+    if (count * 100u >= total * percent) {
+      break;
+    }
+  }
+  if (i >= SLI_ZIGBEE_EVENT_PROFILER_BUCKETS - 1) {
+    return max;
+  }
+  bound = (i == 0) ? 0 : ((1UL << i) - 1);
+  return (bound < max) ? bound : max;
+}
+
+void sli_zigbee_event_profiler_reset(void)
+{
+  memset(event_profiles, 0, sizeof(event_profiles));
+  event_profile_count = 0;
+  event_profile_dropped = 0;
+}
+#endif // SL_ZIGBEE_EVENT_PROFILER_ENABLED
+
+#if SL_ZIGBEE_SLEEP_TELEMETRY_ENABLED
+static sli_zigbee_sleep_decision_t sleep_decisions[SL_ZIGBEE_SLEEP_TELEMETRY_LOG_SIZE];
+static uint8_t sleep_decision_head;
+static uint8_t sleep_decision_count;
+static uint32_t sleep_reason_counts[SLI_ZIGBEE_SLEEP_REASON_COUNT];
+
+static const char * const sleep_reason_names[SLI_ZIGBEE_SLEEP_REASON_COUNT] = {
+  "em2-allowed",
+  "forced-awake",
+  "not-joined",
+  "sleep-control",
+  "backoff",
+  "app-event-due",
+  "app-rejected",
+  "stack-busy",
+  "not-sleepy-device",
+  "stack-event-due",
+  "ncp-busy",
+  "host-sleep-mode",
+};
+
+// The application queue keeps its events ordered by execution time, and ISR
+// events are due immediately, so the head of the queue is the next event.
+static const char *sleep_telemetry_next_event_name(void)
+{
+  const sli_zigbee_event_t *next = sli_zigbee_af_app_event_queue.isrEvents;
+
+  if (next == NULL) {
+    next = sli_zigbee_af_app_event_queue.events;
+  }
+  return (next == NULL) ? NULL : next->actions.name;
+}
+
+void sli_zigbee_sleep_telemetry_record(uint8_t source,
+                                       uint8_t reason,
+                                       uint32_t ms_to_next_wakeup)
+{
+  sli_zigbee_sleep_decision_t *decision;
+  const char *next_event = NULL;
+
+  if (reason >= SLI_ZIGBEE_SLEEP_REASON_COUNT) {
+    return;
+  }
+  if (sleep_reason_counts[reason] < UINT32_MAX) {
+    sleep_reason_counts[reason]++;
+  }
+  if (reason == SLI_ZIGBEE_SLEEP_REASON_APP_EVENT_DUE) {
+    next_event = sleep_telemetry_next_event_name();
+  }
+
+  // The sleep checks run on every pass of the main loop while awake, so merge
+  // identical consecutive decisions instead of flooding the log.
+  if (sleep_decision_count > 0) {
+    decision = &sleep_decisions[(sleep_decision_head + SL_ZIGBEE_SLEEP_TELEMETRY_LOG_SIZE - 1)
+                                % SL_ZIGBEE_SLEEP_TELEMETRY_LOG_SIZE];
+    if (decision->source == source
+        && decision->reason == reason
+        && decision->next_event == next_event
+        && decision->repeat_count < UINT16_MAX) {
+      decision->timestamp_ms = halCommonGetInt32uMillisecondTick();
+      decision->ms_to_next_wakeup = ms_to_next_wakeup;
+      decision->repeat_count++;
+      return;
+    }
+  }
+
+  decision = &sleep_decisions[sleep_decision_head];
+  decision->timestamp_ms = halCommonGetInt32uMillisecondTick();
+  decision->ms_to_next_wakeup = ms_to_next_wakeup;
+  decision->slept_ms = 0;
+  decision->next_event = next_event;
+  decision->repeat_count = 1;
+  decision->source = source;
+  decision->reason = reason;
+  sleep_decision_head = (sleep_decision_head + 1) % SL_ZIGBEE_SLEEP_TELEMETRY_LOG_SIZE;
+  if (sleep_decision_count < SL_ZIGBEE_SLEEP_TELEMETRY_LOG_SIZE) {
+    sleep_decision_count++;
+  }
+}
+
+void sli_zigbee_sleep_telemetry_on_wakeup(uint32_t slept_ms)
+{
+  sli_zigbee_sleep_decision_t *decision;
+
+  if (sleep_decision_count == 0) {
+    return;
+  }
+  decision = &sleep_decisions[(sleep_decision_head + SL_ZIGBEE_SLEEP_TELEMETRY_LOG_SIZE - 1)
+                              % SL_ZIGBEE_SLEEP_TELEMETRY_LOG_SIZE];
+  decision->slept_ms = (decision->slept_ms <= UINT32_MAX - slept_ms)
+                       ? decision->slept_ms + slept_ms
+                       : UINT32_MAX;
+}
+
+const sli_zigbee_sleep_decision_t *sli_zigbee_sleep_telemetry_get(uint8_t index)
+{
+  if (index >= sleep_decision_count) {
+    return NULL;
+  }
+  return &sleep_decisions[(sleep_decision_head + SL_ZIGBEE_SLEEP_TELEMETRY_LOG_SIZE
+                           - sleep_decision_count + index)
+                          % SL_ZIGBEE_SLEEP_TELEMETRY_LOG_SIZE];
+}
+
+uint32_t sli_zigbee_sleep_telemetry_get_count(uint8_t reason)
+{
+  return (reason < SLI_ZIGBEE_SLEEP_REASON_COUNT) ? sleep_reason_counts[reason] : 0;
+}
+
+const char *sli_zigbee_sleep_telemetry_reason_name(uint8_t reason)
+{
+  return (reason < SLI_ZIGBEE_SLEEP_REASON_COUNT) ? sleep_reason_names[reason] : "?";
+}
+
+void sli_zigbee_sleep_telemetry_reset(void)
+{
+  memset(sleep_decisions, 0, sizeof(sleep_decisions));
+  memset(sleep_reason_counts, 0, sizeof(sleep_reason_counts));
+  sleep_decision_head = 0;
+  sleep_decision_count = 0;
+}
+#endif // SL_ZIGBEE_SLEEP_TELEMETRY_ENABLED
+
 static void event_common_handler(sl_zigbee_af_event_t *event)
 {
+#if SL_ZIGBEE_EVENT_PROFILER_ENABLED
+  uint32_t now_ms = halCommonGetInt32uMillisecondTick();
+  uint32_t late_ms = timeGTorEqualInt32u(now_ms, event->timeToExecute)
+                     ? elapsedTimeInt32u(event->timeToExecute, now_ms)
+                     : 0;
+  uint32_t start_tick = event_profiler_get_tick();
+#endif // SL_ZIGBEE_EVENT_PROFILER_ENABLED
   bool is_network_event = sli_zigbee_af_event_is_network_event(event);
   bool is_endpoint_event = sli_zigbee_af_event_is_endpoint_event(event);
 
@@ -197,6 +476,10 @@ static void event_common_handler(sl_zigbee_af_event_t *event)
   if (is_network_event || is_endpoint_event) {
     sl_zigbee_af_pop_network_index();
   }
+
+#if SL_ZIGBEE_EVENT_PROFILER_ENABLED
+  event_profiler_record(event, late_ms, event_profiler_elapsed_us(start_tick));
+#endif // SL_ZIGBEE_EVENT_PROFILER_ENABLED
 }
 
 void sli_zigbee_af_event_internal_init(sl_zigbee_af_event_t *event,
@@ -71,6 +71,104 @@ bool sli_zigbee_app_framework_is_force_sleep(void);
 void sl_zigbee_ncp_spi_sleep_tick();
 #endif // EZSP_SPI
 
+//------------------------------------------------------------------------------
+// Application event profiler
+
+#include "zigbee_event_profiler_config.h"
+
+#if SL_ZIGBEE_EVENT_PROFILER_ENABLED
+// Histogram bucket n counts samples in [2^(n-1), 2^n), bucket 0 counts zeros
+// and the last bucket collects everything above its lower bound.
+#define SLI_ZIGBEE_EVENT_PROFILER_BUCKETS (16)
+
+typedef struct {
+  const sl_zigbee_af_event_t *event;
+  uint32_t run_count;
+  uint32_t total_run_us;
+  uint32_t max_run_us;
+  uint32_t max_late_ms;
+  uint16_t run_us_histogram[SLI_ZIGBEE_EVENT_PROFILER_BUCKETS];
+  uint16_t late_ms_histogram[SLI_ZIGBEE_EVENT_PROFILER_BUCKETS];
+} sli_zigbee_event_profile_t;
+
+// Returns the profile at index, or NULL past the last profiled event.
+const sli_zigbee_event_profile_t *sli_zigbee_event_profiler_get(uint8_t index);
+// Returns the number of dispatches that did not fit in the profile table.
+uint32_t sli_zigbee_event_profiler_get_dropped(void);
+// Returns an upper bound of the given percentile: the upper bound of the
+// histogram bucket holding it, capped at the recorded maximum. The last
+// bucket has no upper bound, so the maximum is returned for it.
+uint32_t sli_zigbee_event_profiler_percentile(const uint16_t *histogram,
+                                              uint8_t percent,
+                                              uint32_t max);
+void sli_zigbee_event_profiler_reset(void);
+#endif // SL_ZIGBEE_EVENT_PROFILER_ENABLED
+
+//------------------------------------------------------------------------------
+// Sleep decision telemetry
+
+#ifdef SL_CATALOG_POWER_MANAGER_PRESENT
+#include "zigbee_sleep_config.h"
+#endif
+
+#ifndef SL_ZIGBEE_SLEEP_TELEMETRY_ENABLED
+#define SL_ZIGBEE_SLEEP_TELEMETRY_ENABLED (0)
+#endif
+
+// Which sleep check made the decision.
+enum {
+  SLI_ZIGBEE_SLEEP_SOURCE_APP_FRAMEWORK,
+  SLI_ZIGBEE_SLEEP_SOURCE_STACK,
+};
+
+// Why the device was allowed into EM2, or what kept it in EM1/EM0.
+enum {
+  SLI_ZIGBEE_SLEEP_REASON_EM2_ALLOWED,
+  SLI_ZIGBEE_SLEEP_REASON_FORCED_AWAKE,
+  SLI_ZIGBEE_SLEEP_REASON_NOT_JOINED,
+  SLI_ZIGBEE_SLEEP_REASON_SLEEP_CONTROL,
+  SLI_ZIGBEE_SLEEP_REASON_BACKOFF,
+  SLI_ZIGBEE_SLEEP_REASON_APP_EVENT_DUE,
+  SLI_ZIGBEE_SLEEP_REASON_APP_REJECTED,
+  SLI_ZIGBEE_SLEEP_REASON_STACK_BUSY,
+  SLI_ZIGBEE_SLEEP_REASON_NOT_SLEEPY_DEVICE,
+  SLI_ZIGBEE_SLEEP_REASON_STACK_EVENT_DUE,
+  SLI_ZIGBEE_SLEEP_REASON_NCP_BUSY,
+  SLI_ZIGBEE_SLEEP_REASON_HOST_SLEEP_MODE,
+  SLI_ZIGBEE_SLEEP_REASON_COUNT
+};
+
+#if SL_ZIGBEE_SLEEP_TELEMETRY_ENABLED
+#ifndef SL_ZIGBEE_SLEEP_TELEMETRY_LOG_SIZE
+#define SL_ZIGBEE_SLEEP_TELEMETRY_LOG_SIZE (16)
+#endif
+
+typedef struct {
+  uint32_t timestamp_ms;       // Time of the latest identical decision.
+  uint32_t ms_to_next_wakeup;  // Duration returned by the latest identical decision.
+  uint32_t slept_ms;           // Total time spent in EM2 after these decisions.
+  const char *next_event;      // Next application event, for APP_EVENT_DUE.
+  uint16_t repeat_count;       // Number of identical consecutive decisions.
+  uint8_t source;
+  uint8_t reason;
+} sli_zigbee_sleep_decision_t;
+
+void sli_zigbee_sleep_telemetry_record(uint8_t source,
+                                       uint8_t reason,
+                                       uint32_t ms_to_next_wakeup);
+// Adds the time spent in EM2 to the latest decision.
+void sli_zigbee_sleep_telemetry_on_wakeup(uint32_t slept_ms);
+// Returns the decision at index, oldest first, or NULL past the latest one.
+const sli_zigbee_sleep_decision_t *sli_zigbee_sleep_telemetry_get(uint8_t index);
+// Returns the number of decisions made for the given reason.
+uint32_t sli_zigbee_sleep_telemetry_get_count(uint8_t reason);
+const char *sli_zigbee_sleep_telemetry_reason_name(uint8_t reason);
+void sli_zigbee_sleep_telemetry_reset(void);
+#else
+#define sli_zigbee_sleep_telemetry_record(source, reason, ms_to_next_wakeup)
+#define sli_zigbee_sleep_telemetry_on_wakeup(slept_ms)
+#endif // SL_ZIGBEE_SLEEP_TELEMETRY_ENABLED
+
 //------------------------------------------------------------------------------
 // Internal debug print stub macros
 
@@ -76,6 +76,9 @@ static sl_power_manager_em_transition_event_info_t pm_event_info =
 bool sli_zigbee_af_stay_awake_when_not_joined = (SL_ZIGBEE_APP_FRAMEWORK_STAY_AWAKE_WHEN_NOT_JOINED ? true : false);
 bool sli_zigbee_af_force_end_device_to_stay_awake = false;
 uint32_t lastWakeupMs = 0;
+#if SL_ZIGBEE_SLEEP_TELEMETRY_ENABLED
+static uint32_t em2_entry_ms = 0;
+#endif // SL_ZIGBEE_SLEEP_TELEMETRY_ENABLED
 
 #if !defined(SL_CATALOG_KERNEL_PRESENT)
 static void wakeup_timer_callback(sl_sleeptimer_timer_handle_t* timer_id, void *user);
@@ -172,9 +175,31 @@ static void energy_mode_transition_callback(sl_power_manager_em_t from,
   (void)to;
   if (from == SL_POWER_MANAGER_EM2) { // Leaving EM2
     lastWakeupMs = halCommonGetInt32uMillisecondTick();
+#if SL_ZIGBEE_SLEEP_TELEMETRY_ENABLED
+    sli_zigbee_sleep_telemetry_on_wakeup(elapsedTimeInt32u(em2_entry_ms, lastWakeupMs));
+#endif // SL_ZIGBEE_SLEEP_TELEMETRY_ENABLED
   }
+#if SL_ZIGBEE_SLEEP_TELEMETRY_ENABLED
+  if (to == SL_POWER_MANAGER_EM2) { // Entering EM2
+    em2_entry_ms = halCommonGetInt32uMillisecondTick();
+  }
+#endif // SL_ZIGBEE_SLEEP_TELEMETRY_ENABLED
 }
 
+#if SL_ZIGBEE_SLEEP_TELEMETRY_ENABLED
+// Finds which of the checks in sli_zigbee_af_ok_to_idle_or_sleep() failed.
+static uint8_t stay_awake_reason(void)
+{
+  if (sli_zigbee_af_force_end_device_to_stay_awake) {
+    return SLI_ZIGBEE_SLEEP_REASON_FORCED_AWAKE;
+  }
+  if (sli_zigbee_af_check_stay_awake_when_not_joined()) {
+    return SLI_ZIGBEE_SLEEP_REASON_NOT_JOINED;
+  }
+  return SLI_ZIGBEE_SLEEP_REASON_SLEEP_CONTROL;
+}
+#endif // SL_ZIGBEE_SLEEP_TELEMETRY_ENABLED
+
 // This function is called from both baremetal and RTOS applications
 // Its primary purpose is to check all application idle/sleep override flags and
 // the time-remaining to the next stack and application events to answer two questions:
@@ -186,6 +211,9 @@ static void energy_mode_transition_callback(sl_power_manager_em_t from,
 uint32_t sli_zigbee_app_framework_set_pm_requirements_and_get_ms_to_next_wakeup(void)
 {
   uint32_t duration_ms = 0;
+#if SL_ZIGBEE_SLEEP_TELEMETRY_ENABLED
+  uint8_t reason = SLI_ZIGBEE_SLEEP_REASON_EM2_ALLOWED;
+#endif // SL_ZIGBEE_SLEEP_TELEMETRY_ENABLED
 
   // Check if sleep is permitted
   bool in_sleep_backoff;
@@ -199,6 +227,14 @@ uint32_t sli_zigbee_app_framework_set_pm_requirements_and_get_ms_to_next_wakeup(
   // Check if the micro can go into EM2
   bool sleep_allowed = (ok_to_idle_or_sleep && !in_sleep_backoff);
 
+#if SL_ZIGBEE_SLEEP_TELEMETRY_ENABLED
+  if (!sleep_allowed) {
+    reason = (ok_to_idle_or_sleep
+              ? SLI_ZIGBEE_SLEEP_REASON_BACKOFF
+              : stay_awake_reason());
+  }
+#endif // SL_ZIGBEE_SLEEP_TELEMETRY_ENABLED
+
   if (sleep_allowed) {
     duration_ms = sli_zigbee_af_ms_to_next_event();
 
@@ -211,6 +247,11 @@ uint32_t sli_zigbee_app_framework_set_pm_requirements_and_get_ms_to_next_wakeup(
     // on whether it is ok to go to EM2
     if (duration_ms < SL_ZIGBEE_APP_FRAMEWORK_MINIMUM_SLEEP_DURATION_MS
         || !sl_zigbee_af_idle_sleep_ok_to_sleep_cb(duration_ms)) {
+#if SL_ZIGBEE_SLEEP_TELEMETRY_ENABLED
+      reason = (duration_ms < SL_ZIGBEE_APP_FRAMEWORK_MINIMUM_SLEEP_DURATION_MS
+                ? SLI_ZIGBEE_SLEEP_REASON_APP_EVENT_DUE
+                : SLI_ZIGBEE_SLEEP_REASON_APP_REJECTED);
+#endif // SL_ZIGBEE_SLEEP_TELEMETRY_ENABLED
       duration_ms = 0;
 #if (!defined(_SILICON_LABS_32B_SERIES_3))
       if (!em1_requirement_set) {
@@ -249,6 +290,10 @@ uint32_t sli_zigbee_app_framework_set_pm_requirements_and_get_ms_to_next_wakeup(
     duration_ms = sli_zigbee_af_ms_to_next_event();
   }
 
+  sli_zigbee_sleep_telemetry_record(SLI_ZIGBEE_SLEEP_SOURCE_APP_FRAMEWORK,
+                                    reason,
+                                    duration_ms);
+
   return (duration_ms);
 }
 
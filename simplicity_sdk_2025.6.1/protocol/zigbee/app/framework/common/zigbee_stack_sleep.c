@@ -50,6 +50,7 @@ bool ncp_ok_to_sleep (void);
 #endif // SL_CATALOG_ZIGBEE_FORCE_SLEEP_AND_WAKEUP_PRESENT
 
 #include "zigbee_device_config.h"
+#include "sl_zigbee_system_common.h"
 
 extern uint32_t sli_zigbee_stack_ms_to_next_stack_event(void);
 
@@ -179,21 +180,40 @@ sl_power_manager_on_isr_exit_t sli_zigbee_stack_sleep_on_isr_exit(void)
 uint32_t sli_zigbee_stack_get_ms_to_next_wakeup(void)
 {
   uint32_t duration_ms = 0;
+#if SL_ZIGBEE_SLEEP_TELEMETRY_ENABLED
+  uint8_t reason = SLI_ZIGBEE_SLEEP_REASON_EM2_ALLOWED;
+#endif // SL_ZIGBEE_SLEEP_TELEMETRY_ENABLED
 
   // Check if sleep is permitted
   // Note that for about 5 seconds after initialization and before radio is on,
   // this function returns that it is okay to sleep
   // to keep CLI functional, we have added a check for device type as well
-  bool stack_is_ok_to_nap = sli_zigbee_stack_ok_to_nap() && ((sl_zigbee_network_state() == SL_ZIGBEE_JOINED_NETWORK)
-                                                             ? (sli_zigbee_node_type >= SL_ZIGBEE_SLEEPY_END_DEVICE)
-                                                             : (SLI_ZIGBEE_PRIMARY_NETWORK_DEVICE_TYPE == SLI_ZIGBEE_NETWORK_DEVICE_TYPE_SLEEPY_END_DEVICE \
-                                                                || (SLI_ZIGBEE_SECONDARY_NETWORK_ENABLED == 1                                              \
-                                                                    && SLI_ZIGBEE_SECONDARY_NETWORK_DEVICE_TYPE == SLI_ZIGBEE_NETWORK_DEVICE_TYPE_SLEEPY_END_DEVICE)));
+  bool stack_ok_to_nap = sli_zigbee_stack_ok_to_nap();
+  bool is_sleepy_device = ((sl_zigbee_network_state() == SL_ZIGBEE_JOINED_NETWORK)
+                           ? (sli_zigbee_node_type >= SL_ZIGBEE_SLEEPY_END_DEVICE)
+                           : (SLI_ZIGBEE_PRIMARY_NETWORK_DEVICE_TYPE == SLI_ZIGBEE_NETWORK_DEVICE_TYPE_SLEEPY_END_DEVICE \
+                              || (SLI_ZIGBEE_SECONDARY_NETWORK_ENABLED == 1                                              \
+                                  && SLI_ZIGBEE_SECONDARY_NETWORK_DEVICE_TYPE == SLI_ZIGBEE_NETWORK_DEVICE_TYPE_SLEEPY_END_DEVICE)));
+  bool stack_is_ok_to_nap = stack_ok_to_nap && is_sleepy_device;
 
 #ifdef SL_ZIGBEE_AF_NCP
-  stack_is_ok_to_nap = stack_is_ok_to_nap && ncp_ok_to_sleep();
+  bool ncp_is_ok_to_sleep = stack_is_ok_to_nap && ncp_ok_to_sleep();
+#if SL_ZIGBEE_SLEEP_TELEMETRY_ENABLED
+  if (stack_is_ok_to_nap && !ncp_is_ok_to_sleep) {
+    reason = SLI_ZIGBEE_SLEEP_REASON_NCP_BUSY;
+  }
+#endif // SL_ZIGBEE_SLEEP_TELEMETRY_ENABLED
+  stack_is_ok_to_nap = ncp_is_ok_to_sleep;
 #endif //SL_ZIGBEE_AF_NCP
 
+#if SL_ZIGBEE_SLEEP_TELEMETRY_ENABLED
+  if (!stack_ok_to_nap) {
+    reason = SLI_ZIGBEE_SLEEP_REASON_STACK_BUSY;
+  } else if (!is_sleepy_device) {
+    reason = SLI_ZIGBEE_SLEEP_REASON_NOT_SLEEPY_DEVICE;
+  }
+#endif // SL_ZIGBEE_SLEEP_TELEMETRY_ENABLED
+
   if (stack_is_ok_to_nap) {
     // If the stack says we can hiberate, it means we can sleep as long as we
     // want.  Otherwise, we cannot sleep longer than the duration to its next
@@ -207,6 +227,11 @@ uint32_t sli_zigbee_stack_get_ms_to_next_wakeup(void)
   // If durations_ms is 0 it means we could not enter em2, so we see how long we
   // can enter em1 instead. Ensure application permits EM1
   if (duration_ms == 0) {
+#if SL_ZIGBEE_SLEEP_TELEMETRY_ENABLED
+    if (reason == SLI_ZIGBEE_SLEEP_REASON_EM2_ALLOWED) {
+      reason = SLI_ZIGBEE_SLEEP_REASON_STACK_EVENT_DUE;
+    }
+#endif // SL_ZIGBEE_SLEEP_TELEMETRY_ENABLED
 #if (!defined(_SILICON_LABS_32B_SERIES_3))
     if (!zigbee_stack_em1_requirement_set) {
       zigbee_stack_em1_requirement_set = true;
@@ -223,6 +248,10 @@ uint32_t sli_zigbee_stack_get_ms_to_next_wakeup(void)
 #endif //!defined(_SILICON_LABS_32B_SERIES_3)
   }
 
+  sli_zigbee_sleep_telemetry_record(SLI_ZIGBEE_SLEEP_SOURCE_STACK,
+                                    reason,
+                                    duration_ms);
+
   return (duration_ms);
 }
 
@@ -272,6 +301,9 @@ static void sleep_tick(uint32_t *ms_to_next_event, bool *enter_em2)
       || !serialOkToSleep()
       || (stack_tasks & (SL_ZIGBEE_OUTGOING_MESSAGES | SL_ZIGBEE_INCOMING_MESSAGES))
       || ((sli_zigbee_node_type == SL_ZIGBEE_SLEEPY_END_DEVICE) & (stack_tasks & SL_ZIGBEE_RADIO_IS_ON))) {
+    sli_zigbee_sleep_telemetry_record(SLI_ZIGBEE_SLEEP_SOURCE_STACK,
+                                      SLI_ZIGBEE_SLEEP_REASON_NCP_BUSY,
+                                      0);
     return;
   }
 
@@ -295,7 +327,13 @@ static void sleep_tick(uint32_t *ms_to_next_event, bool *enter_em2)
     }
 #endif //!defined(_SILICON_LABS_32B_SERIES_3)
     *enter_em2 = true;
+    sli_zigbee_sleep_telemetry_record(SLI_ZIGBEE_SLEEP_SOURCE_STACK,
+                                      SLI_ZIGBEE_SLEEP_REASON_EM2_ALLOWED,
+                                      *ms_to_next_event);
   } else {
+    sli_zigbee_sleep_telemetry_record(SLI_ZIGBEE_SLEEP_SOURCE_STACK,
+                                      SLI_ZIGBEE_SLEEP_REASON_HOST_SLEEP_MODE,
+                                      *ms_to_next_event);
 #if (!defined(_SILICON_LABS_32B_SERIES_3))
     // The NCP always idles its processor whenever possible
     if (!zigbee_stack_em1_requirement_set) {
@@ -20,6 +20,7 @@
 #include "app/util/common/common.h"
 #include "counters.h"
 #include "counters-ota.h"
+#include "counters-metrics.h"
 
 uint16_t sl_zigbee_counters[SL_ZIGBEE_COUNTER_TYPE_COUNT];
 uint16_t sl_zigbee_counters_thresholds[SL_ZIGBEE_COUNTER_TYPE_COUNT];
@@ -30,6 +31,9 @@ void sl_zigbee_af_counters_init_cb(uint8_t init_level)
 
   sl_zigbee_af_counters_clear();
   sl_zigbee_af_counters_reset_thresholds();
+#ifdef COUNTERS_METRICS_ENABLED
+  sli_zigbee_af_counters_metrics_init();
+#endif
 }
 
 SL_CODE_CLASSIFY(SL_CODE_COMPONENT_ZIGBEE_STACK, SL_CODE_CLASS_TIME_CRITICAL)
@@ -21,6 +21,7 @@
 #include "app/util/common/common.h"
 #include "counters.h"
 #include "counters-ota.h"
+#include "counters-metrics.h"
 #include "counters-cli.h"
 
 #include "app/util/serial/sl_zigbee_command_interpreter.h"
@@ -121,3 +122,72 @@ void sl_zigbee_af_counters_reset_thresholds_command(sl_cli_command_arg_t *args)
   (void) args;
   sl_zigbee_af_counters_reset_thresholds();
 }
+
+void sl_zigbee_af_counters_send_metrics_request_command(sl_cli_command_arg_t *args)
+{
+#if defined(OTA_COUNTERS_ENABLED)
+  sl_zigbee_af_counters_send_metrics_request(sl_cli_get_argument_uint16(args, 0));
+#endif
+}
+
+#if defined(COUNTERS_METRICS_ENABLED)
+static const char * histogramStrings[] = {
+  "MAC retries",
+  "APS retries",
+  "APS ack latency (ms)",
+};
+#endif
+
+void sl_zigbee_af_counters_metrics_print_command(sl_cli_command_arg_t *args)
+{
+  (void) args;
+#if defined(COUNTERS_METRICS_ENABLED)
+  uint16_t buckets[SL_ZIGBEE_AF_PLUGIN_COUNTERS_METRICS_HISTOGRAM_BUCKETS];
+  uint8_t i;
+  uint8_t j;
+
+  sl_zigbee_af_core_println("Rates (last minute, last hour):");
+  for (i = 0; i < SL_ZIGBEE_COUNTER_TYPE_COUNT; i++) {
+    uint16_t perMinute;
+    uint16_t perHour;
+    sl_zigbee_af_counters_metrics_get_rate(i, &perMinute, &perHour);
+    if (perMinute != 0 || perHour != 0) {
+      sl_zigbee_af_core_println("%u) %s: %u, %u",
+                                i,
+                                (titleStrings[i] == NULL
+                                 ? unknownCounter
+                                 : titleStrings[i]),
+                                perMinute,
+                                perHour);
+    }
+  }
+
+  for (i = 0; i < SL_ZIGBEE_AF_COUNTERS_HISTOGRAM_COUNT; i++) {
+    sl_zigbee_af_counters_metrics_get_histogram(i, buckets);
+    sl_zigbee_af_core_println("%s:", histogramStrings[i]);
+    for (j = 0; j < SL_ZIGBEE_AF_PLUGIN_COUNTERS_METRICS_HISTOGRAM_BUCKETS; j++) {
+      if (buckets[j] == 0) {
+        continue;
+      }
+      if (j == 0) {
+        sl_zigbee_af_core_println("  0: %u", buckets[j]);
+      } else if (j + 1 == SL_ZIGBEE_AF_PLUGIN_COUNTERS_METRICS_HISTOGRAM_BUCKETS) {
+        sl_zigbee_af_core_println("  %lu+: %u", 1UL << (j - 1), buckets[j]);
+      } else {
+        sl_zigbee_af_core_println("  %lu-%lu: %u",
+                                  1UL << (j - 1),
+                                  (1UL << j) - 1,
+                                  buckets[j]);
+      }
+    }
+  }
+#endif
+}
+
+void sl_zigbee_af_counters_metrics_clear_command(sl_cli_command_arg_t *args)
+{
+  (void) args;
+#if defined(COUNTERS_METRICS_ENABLED)
+  sl_zigbee_af_counters_metrics_clear();
+#endif
+}
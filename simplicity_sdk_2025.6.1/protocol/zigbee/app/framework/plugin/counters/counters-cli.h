@@ -24,6 +24,9 @@ void sl_zigbee_af_counters_set_threshold_command(sl_cli_command_arg_t *args);
 void sl_zigbee_af_counters_send_request_command(sl_cli_command_arg_t *args);
 void sl_zigbee_af_counters_clear_command(sl_cli_command_arg_t *args);
 void sl_zigbee_af_counters_reset_thresholds_command(sl_cli_command_arg_t *args);
+void sl_zigbee_af_counters_send_metrics_request_command(sl_cli_command_arg_t *args);
+void sl_zigbee_af_counters_metrics_print_command(sl_cli_command_arg_t *args);
+void sl_zigbee_af_counters_metrics_clear_command(sl_cli_command_arg_t *args);
 
 /** Args: destination id, clearCounters (bool) */
 void sendCountersRequestCommand(void);
@@ -0,0 +1,272 @@
+/***************************************************************************//**
+ * @file
+ * @brief Rate and histogram metrics built on the Counters plugin.
+ *******************************************************************************
+ * # License
+ * <b>Copyright 2025 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * The licensor of this software is Silicon Laboratories Inc. Your use of this
+ * software is governed by the terms of Silicon Labs Master Software License
+ * Agreement (MSLA) available at
+ * www.silabs.com/about-us/legal/master-software-license-agreement. This
+ * software is distributed to you in Source Code format and is governed by the
+ * sections of the MSLA applicable to Source Code.
+ *
+ ******************************************************************************/
+
+#include "sl_code_classification.h"
+#include "app/framework/include/af.h"
+#include "counters-metrics.h"
+
+//Include the metrics if enabled by the plugin
+#if defined(COUNTERS_METRICS_ENABLED)
+
+// -----------------------------------------------------------------------------
+// Constants
+
+#define HISTOGRAM_BUCKETS SL_ZIGBEE_AF_PLUGIN_COUNTERS_METRICS_HISTOGRAM_BUCKETS
+
+// Each rate window is made of this many complete buckets plus the bucket that
+// is currently being filled.
+#define RATE_WINDOW_BUCKETS 4
+#define MINUTE_BUCKET_MS    (MILLISECOND_TICKS_PER_MINUTE / RATE_WINDOW_BUCKETS)
+#define HOUR_BUCKET_MS      (MILLISECOND_TICKS_PER_HOUR / RATE_WINDOW_BUCKETS)
+
+// APS unicasts waiting for their ack whose send time is remembered. Later
+// unicasts are not measured until an entry is free.
+#define PENDING_ACKS 8
+
+// -----------------------------------------------------------------------------
+// Globals
+
+typedef struct {
+  uint32_t bucketMs;
+  uint32_t bucketStartMs;
+  uint8_t current;
+  uint16_t counts[RATE_WINDOW_BUCKETS + 1][SL_ZIGBEE_COUNTER_TYPE_COUNT];
+} sli_zigbee_af_counters_rate_window_t;
+
+typedef struct {
+  bool inUse;
+  uint16_t messageTag;
+  uint32_t sentMs;
+} sli_zigbee_af_counters_pending_ack_t;
+
+static sli_zigbee_af_counters_rate_window_t minuteWindow = { MINUTE_BUCKET_MS };
+static sli_zigbee_af_counters_rate_window_t hourWindow = { HOUR_BUCKET_MS };
+static uint16_t histograms[SL_ZIGBEE_AF_COUNTERS_HISTOGRAM_COUNT][HISTOGRAM_BUCKETS];
+static sli_zigbee_af_counters_pending_ack_t pendingAcks[PENDING_ACKS];
+static uint8_t macRetries;
+
+// -----------------------------------------------------------------------------
+// Private API
+
+#define saturatingAdd(counter, value)                \
+  do {                                               \
+    uint32_t sum = (uint32_t)(counter) + (value);    \
+    (counter) = (sum < 0xFFFF ? (uint16_t)sum : 0xFFFF); \
+  } while (0)
+
+// Moves the window forward to the bucket containing now, clearing the buckets
+// that are reused on the way. The window is restarted after a long gap.
+SL_CODE_CLASSIFY(SL_CODE_COMPONENT_ZIGBEE_STACK, SL_CODE_CLASS_TIME_CRITICAL)
+static void advanceWindow(sli_zigbee_af_counters_rate_window_t *window, uint32_t now)
+{
+  uint32_t elapsed = elapsedTimeInt32u(window->bucketStartMs, now);
+
+  if (elapsed >= window->bucketMs * (RATE_WINDOW_BUCKETS + 1)) {
+    memset(window->counts, 0, sizeof(window->counts));
+    window->bucketStartMs = now - (elapsed % window->bucketMs);
+    return;
+  }
+
+  while (elapsed >= window->bucketMs) {
+    window->current = (window->current + 1) % (RATE_WINDOW_BUCKETS + 1);
+    memset(window->counts[window->current], 0, sizeof(window->counts[0]));
+    window->bucketStartMs += window->bucketMs;
+    elapsed -= window->bucketMs;
+  }
+}
+
+SL_CODE_CLASSIFY(SL_CODE_COMPONENT_ZIGBEE_STACK, SL_CODE_CLASS_TIME_CRITICAL)
+static void countEvents(sl_zigbee_counter_type_t type, uint8_t count)
+{
+  saturatingAdd(minuteWindow.counts[minuteWindow.current][type], count);
+  saturatingAdd(hourWindow.counts[hourWindow.current][type], count);
+}
+
+static uint16_t windowTotal(const sli_zigbee_af_counters_rate_window_t *window,
+                            sl_zigbee_counter_type_t type)
+{
+  uint32_t total = 0;
+  uint8_t i;
+
+  for (i = 0; i < RATE_WINDOW_BUCKETS + 1; i++) {
+    if (i != window->current) {
+      total += window->counts[i][type];
+    }
+  }
+  return (total < 0xFFFF ? (uint16_t)total : 0xFFFF);
+}
+
+SL_CODE_CLASSIFY(SL_CODE_COMPONENT_ZIGBEE_STACK, SL_CODE_CLASS_TIME_CRITICAL)
+static uint8_t histogramBucket(uint32_t value)
+{
+  uint8_t bucket = 0;
+
+  // Bucket n holds 2^(n-1) to 2^n - 1.
+  while (value != 0 && bucket < HISTOGRAM_BUCKETS - 1) {
+    value >>= 1;
+    bucket++;
+  }
+  return bucket;
+}
+
+// -----------------------------------------------------------------------------
+// Public API
+
+SL_CODE_CLASSIFY(SL_CODE_COMPONENT_ZIGBEE_STACK, SL_CODE_CLASS_TIME_CRITICAL)
+void sl_zigbee_af_counters_metrics_record(sl_zigbee_af_counters_histogram_t histogram,
+                                          uint32_t value)
+{
+  if (histogram < SL_ZIGBEE_AF_COUNTERS_HISTOGRAM_COUNT) {
+    saturatingAdd(histograms[histogram][histogramBucket(value)], 1);
+  }
+}
+
+sl_status_t sl_zigbee_af_counters_metrics_get_histogram(sl_zigbee_af_counters_histogram_t histogram,
+                                                        uint16_t *buckets)
+{
+  if (histogram >= SL_ZIGBEE_AF_COUNTERS_HISTOGRAM_COUNT) {
+    return SL_STATUS_INVALID_PARAMETER;
+  }
+  memmove(buckets, histograms[histogram], sizeof(histograms[0]));
+  return SL_STATUS_OK;
+}
+
+void sl_zigbee_af_counters_metrics_get_rate(sl_zigbee_counter_type_t type,
+                                            uint16_t *perMinute,
+                                            uint16_t *perHour)
+{
+  uint32_t now = halCommonGetInt32uMillisecondTick();
+
+  *perMinute = 0;
+  *perHour = 0;
+  if (type >= SL_ZIGBEE_COUNTER_TYPE_COUNT) {
+    return;
+  }
+
+  advanceWindow(&minuteWindow, now);
+  advanceWindow(&hourWindow, now);
+  *perMinute = windowTotal(&minuteWindow, type);
+  *perHour = windowTotal(&hourWindow, type);
+}
+
+void sl_zigbee_af_counters_metrics_clear(void)
+{
+  uint32_t now = halCommonGetInt32uMillisecondTick();
+
+  memset(minuteWindow.counts, 0, sizeof(minuteWindow.counts));
+  memset(hourWindow.counts, 0, sizeof(hourWindow.counts));
+  minuteWindow.bucketStartMs = now;
+  hourWindow.bucketStartMs = now;
+  memset(histograms, 0, sizeof(histograms));
+  macRetries = 0;
+}
+
+// -----------------------------------------------------------------------------
+// Internal hooks
+
+void sli_zigbee_af_counters_metrics_init(void)
+{
+  memset(pendingAcks, 0, sizeof(pendingAcks));
+  sl_zigbee_af_counters_metrics_clear();
+}
+
+// Called for every counter event, the same way the stack counters are
+// tallied in sli_zigbee_stack_populate_counters().
+SL_CODE_CLASSIFY(SL_CODE_COMPONENT_ZIGBEE_STACK, SL_CODE_CLASS_TIME_CRITICAL)
+void sli_zigbee_af_counters_metrics_event(sl_zigbee_counter_type_t type, uint8_t data)
+{
+  uint32_t now = halCommonGetInt32uMillisecondTick();
+
+  if (type >= SL_ZIGBEE_COUNTER_TYPE_COUNT) {
+    return;
+  }
+
+  advanceWindow(&minuteWindow, now);
+  advanceWindow(&hourWindow, now);
+  countEvents(type, 1);
+
+  switch (type) {
+    case SL_ZIGBEE_COUNTER_MAC_TX_UNICAST_RETRY:
+      // data is the number of retries of the current frame so far.
+      macRetries = data;
+      break;
+    case SL_ZIGBEE_COUNTER_MAC_TX_UNICAST_SUCCESS:
+    case SL_ZIGBEE_COUNTER_MAC_TX_UNICAST_FAILED:
+      sl_zigbee_af_counters_metrics_record(SL_ZIGBEE_AF_COUNTERS_HISTOGRAM_MAC_RETRIES,
+                                           macRetries);
+      macRetries = 0;
+      break;
+    case SL_ZIGBEE_COUNTER_APS_DATA_TX_UNICAST_SUCCESS:
+    case SL_ZIGBEE_COUNTER_APS_DATA_TX_UNICAST_FAILED:
+      // data is the number of APS retries consumed by this unicast.
+      countEvents(SL_ZIGBEE_COUNTER_APS_DATA_TX_UNICAST_RETRY, data);
+      sl_zigbee_af_counters_metrics_record(SL_ZIGBEE_AF_COUNTERS_HISTOGRAM_APS_RETRIES,
+                                           data);
+      break;
+    case SL_ZIGBEE_COUNTER_PHY_TO_MAC_QUEUE_LIMIT_REACHED:
+      // data is the number of dropped packets, one of which is counted above.
+      if (data > 1) {
+        countEvents(type, data - 1);
+      }
+      break;
+    default:
+      break;
+  }
+}
+
+void sli_zigbee_af_counters_metrics_message_queued(uint16_t messageTag,
+                                                   sl_zigbee_outgoing_message_type_t type,
+                                                   const sl_zigbee_aps_frame_t *apsFrame)
+{
+  uint8_t i;
+
+  if ((type != SL_ZIGBEE_OUTGOING_DIRECT
+       && type != SL_ZIGBEE_OUTGOING_VIA_ADDRESS_TABLE
+       && type != SL_ZIGBEE_OUTGOING_VIA_BINDING)
+      || !(apsFrame->options & SL_ZIGBEE_APS_OPTION_RETRY)) {
+    return;
+  }
+
+  for (i = 0; i < PENDING_ACKS; i++) {
+    if (!pendingAcks[i].inUse) {
+      pendingAcks[i].inUse = true;
+      pendingAcks[i].messageTag = messageTag;
+      pendingAcks[i].sentMs = halCommonGetInt32uMillisecondTick();
+      return;
+    }
+  }
+}
+
+void sli_zigbee_af_counters_metrics_message_sent(uint16_t messageTag,
+                                                 sl_status_t status)
+{
+  uint8_t i;
+
+  for (i = 0; i < PENDING_ACKS; i++) {
+    if (pendingAcks[i].inUse && pendingAcks[i].messageTag == messageTag) {
+      pendingAcks[i].inUse = false;
+      if (status == SL_STATUS_OK) {
+        sl_zigbee_af_counters_metrics_record(SL_ZIGBEE_AF_COUNTERS_HISTOGRAM_APS_ACK_LATENCY_MS,
+                                             elapsedTimeInt32u(pendingAcks[i].sentMs,
+                                                               halCommonGetInt32uMillisecondTick()));
+      }
+      return;
+    }
+  }
+}
+
+#endif // COUNTERS_METRICS_ENABLED
@@ -0,0 +1,114 @@
+/***************************************************************************//**
+ * @file
+ * @brief Rate and histogram metrics built on the Counters plugin.
+ *
+ * The metrics layer watches the same counter events as the stack counters and
+ * keeps, for every ::sl_zigbee_counter_type_t, the number of events in the
+ * last complete minute and the last complete hour. It also keeps histograms
+ * with logarithmic buckets of per-message quantities that a 16-bit event count
+ * cannot show, such as the number of MAC retries per unicast or the time an
+ * APS unicast waited for its ack.
+ *
+ * Bucket 0 of a histogram counts the value 0 and bucket n counts the values
+ * from 2^(n-1) to 2^n - 1. The last bucket also counts every larger value.
+ * All counts saturate at 0xFFFF.
+ *
+ * Counter rates and the MAC and APS retry histograms are fed from counter
+ * events, which are only seen on an SoC. APS ack latency is measured for
+ * unicasts sent through the application framework with APS retries.
+ *******************************************************************************
+ * # License
+ * <b>Copyright 2025 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * The licensor of this software is Silicon Laboratories Inc. Your use of this
+ * software is governed by the terms of Silicon Labs Master Software License
+ * Agreement (MSLA) available at
+ * www.silabs.com/about-us/legal/master-software-license-agreement. This
+ * software is distributed to you in Source Code format and is governed by the
+ * sections of the MSLA applicable to Source Code.
+ *
+ ******************************************************************************/
+
+#ifndef SILABS_PLUGIN_COUNTERS_METRICS_H
+#define SILABS_PLUGIN_COUNTERS_METRICS_H
+
+#include "counters-config.h"
+#if (SL_ZIGBEE_AF_PLUGIN_COUNTERS_METRICS == 1)
+#define COUNTERS_METRICS_ENABLED
+#endif
+
+#ifndef SL_ZIGBEE_AF_PLUGIN_COUNTERS_METRICS_HISTOGRAM_BUCKETS
+#define SL_ZIGBEE_AF_PLUGIN_COUNTERS_METRICS_HISTOGRAM_BUCKETS 12
+#endif
+
+/**
+ * @addtogroup counters
+ * @{
+ */
+
+/** The histograms kept by the metrics layer. */
+typedef enum {
+  /** MAC retries consumed by each unicast, successful or not. */
+  SL_ZIGBEE_AF_COUNTERS_HISTOGRAM_MAC_RETRIES        = 0,
+  /** APS retries consumed by each APS unicast, successful or not. */
+  SL_ZIGBEE_AF_COUNTERS_HISTOGRAM_APS_RETRIES        = 1,
+  /** Milliseconds from sending an APS unicast to receiving its ack. */
+  SL_ZIGBEE_AF_COUNTERS_HISTOGRAM_APS_ACK_LATENCY_MS = 2,
+  SL_ZIGBEE_AF_COUNTERS_HISTOGRAM_COUNT              = 3,
+} sl_zigbee_af_counters_histogram_t;
+
+/**
+ * @name API
+ * @{
+ */
+
+/** @brief Add a value to a histogram.
+ *
+ * @param[in] histogram The histogram to update.
+ * @param[in] value The value to count, in the unit of the histogram.
+ */
+void sl_zigbee_af_counters_metrics_record(sl_zigbee_af_counters_histogram_t histogram,
+                                          uint32_t value);
+
+/** @brief Copy the buckets of a histogram.
+ *
+ * @param[in] histogram The histogram to read.
+ * @param[out] buckets Receives
+ * ::SL_ZIGBEE_AF_PLUGIN_COUNTERS_METRICS_HISTOGRAM_BUCKETS counts.
+ * @return SL_STATUS_INVALID_PARAMETER if the histogram is unknown, otherwise
+ * SL_STATUS_OK.
+ */
+sl_status_t sl_zigbee_af_counters_metrics_get_histogram(sl_zigbee_af_counters_histogram_t histogram,
+                                                        uint16_t *buckets);
+
+/** @brief Get the recent event rate of a counter.
+ *
+ * The windows advance in steps of a quarter of their length, so the counts
+ * cover the last complete minute and hour, which ended at most 15 seconds and
+ * 15 minutes ago respectively.
+ *
+ * @param[in] type The counter.
+ * @param[out] perMinute The number of events in the last complete minute.
+ * @param[out] perHour The number of events in the last complete hour.
+ */
+void sl_zigbee_af_counters_metrics_get_rate(sl_zigbee_counter_type_t type,
+                                            uint16_t *perMinute,
+                                            uint16_t *perHour);
+
+/** @brief Clear all rates and histograms. */
+void sl_zigbee_af_counters_metrics_clear(void);
+
+/** @} */ // end of name API
+/** @} */ // end of counters
+
+// Internal hooks of the counters and the application framework.
+void sli_zigbee_af_counters_metrics_init(void);
+void sli_zigbee_af_counters_metrics_event(sl_zigbee_counter_type_t type, uint8_t data);
+void sli_zigbee_af_counters_metrics_message_queued(uint16_t messageTag,
+                                                   sl_zigbee_outgoing_message_type_t type,
+                                                   const sl_zigbee_aps_frame_t *apsFrame);
+void sli_zigbee_af_counters_metrics_message_sent(uint16_t messageTag,
+                                                 sl_status_t status);
+
+#endif // SILABS_PLUGIN_COUNTERS_METRICS_H
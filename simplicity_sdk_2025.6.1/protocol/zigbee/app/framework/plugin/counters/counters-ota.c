@@ -19,6 +19,7 @@
 #include "app/util/common/common.h"
 #include "counters.h"
 #include "counters-ota.h"
+#include "counters-metrics.h"
 
 //Include counters-ota if enabled by the plugin
 #if defined(OTA_COUNTERS_ENABLED)
@@ -55,12 +56,77 @@ sl_status_t sl_zigbee_af_counters_send_request(sl_802154_short_addr_t destinatio
                      NULL);
 }
 
+sl_status_t sl_zigbee_af_counters_send_metrics_request(sl_802154_short_addr_t destination)
+{
+  return sendCluster(destination,
+                     SL_ZIGBEE_REPORT_COUNTER_METRICS_REQUEST,
+                     0,
+                     NULL);
+}
+
+#if defined(COUNTERS_METRICS_ENABLED)
+static void sendMetrics(sl_802154_short_addr_t destination)
+{
+  uint16_t buckets[SL_ZIGBEE_AF_PLUGIN_COUNTERS_METRICS_HISTOGRAM_BUCKETS];
+  uint8_t reply[MAX_PAYLOAD_LENGTH];
+  uint8_t length = 0;
+  uint8_t i;
+  uint8_t j;
+
+  for (i = 0; i < SL_ZIGBEE_COUNTER_TYPE_COUNT; i++) {
+    uint16_t perMinute;
+    uint16_t perHour;
+
+    sl_zigbee_af_counters_metrics_get_rate(i, &perMinute, &perHour);
+    if (perMinute == 0 && perHour == 0) {
+      continue;
+    }
+    if (length + 5 > MAX_PAYLOAD_LENGTH) {
+      sendCluster(destination, SL_ZIGBEE_REPORT_COUNTER_METRICS_RESPONSE, length, reply);
+      length = 0;
+    }
+    reply[length] = i;
+    reply[length + 1] = LOW_BYTE(perMinute);
+    reply[length + 2] = HIGH_BYTE(perMinute);
+    reply[length + 3] = LOW_BYTE(perHour);
+    reply[length + 4] = HIGH_BYTE(perHour);
+    length += 5;
+  }
+
+  for (i = 0; i < SL_ZIGBEE_AF_COUNTERS_HISTOGRAM_COUNT; i++) {
+    sl_zigbee_af_counters_metrics_get_histogram(i, buckets);
+    if (length + 2 + sizeof(buckets) > MAX_PAYLOAD_LENGTH) {
+      sendCluster(destination, SL_ZIGBEE_REPORT_COUNTER_METRICS_RESPONSE, length, reply);
+      length = 0;
+    }
+    reply[length] = SL_ZIGBEE_COUNTER_METRICS_HISTOGRAM_FLAG | i;
+    reply[length + 1] = SL_ZIGBEE_AF_PLUGIN_COUNTERS_METRICS_HISTOGRAM_BUCKETS;
+    length += 2;
+    for (j = 0; j < SL_ZIGBEE_AF_PLUGIN_COUNTERS_METRICS_HISTOGRAM_BUCKETS; j++) {
+      reply[length] = LOW_BYTE(buckets[j]);
+      reply[length + 1] = HIGH_BYTE(buckets[j]);
+      length += 2;
+    }
+  }
+
+  sendCluster(destination, SL_ZIGBEE_REPORT_COUNTER_METRICS_RESPONSE, length, reply);
+}
+#endif // COUNTERS_METRICS_ENABLED
+
 bool sl_zigbee_af_counters_is_incoming_request(sl_zigbee_aps_frame_t *apsFrame, sl_802154_short_addr_t sender)
 {
   uint8_t reply[MAX_PAYLOAD_LENGTH];
   uint8_t length = 0;
   uint8_t i;
 
+#if defined(COUNTERS_METRICS_ENABLED)
+  if (apsFrame->profileId == SL_ZIGBEE_PRIVATE_PROFILE_ID
+      && apsFrame->clusterId == SL_ZIGBEE_REPORT_COUNTER_METRICS_REQUEST) {
+    sendMetrics(sender);
+    return true;
+  }
+#endif // COUNTERS_METRICS_ENABLED
+
   if (apsFrame->profileId != SL_ZIGBEE_PRIVATE_PROFILE_ID
       || (apsFrame->clusterId != SL_ZIGBEE_REPORT_COUNTERS_REQUEST
           && apsFrame->clusterId != SL_ZIGBEE_REPORT_AND_CLEAR_COUNTERS_REQUEST)) {
@@ -92,13 +158,14 @@ bool sl_zigbee_af_counters_is_incoming_response(sl_zigbee_aps_frame_t *apsFrame)
 {
   return (apsFrame->profileId == SL_ZIGBEE_PRIVATE_PROFILE_ID
           && (apsFrame->clusterId == SL_ZIGBEE_REPORT_AND_CLEAR_COUNTERS_RESPONSE
-              || apsFrame->clusterId == SL_ZIGBEE_REPORT_COUNTERS_RESPONSE));
+              || apsFrame->clusterId == SL_ZIGBEE_REPORT_COUNTERS_RESPONSE
+              || apsFrame->clusterId == SL_ZIGBEE_REPORT_COUNTER_METRICS_RESPONSE));
 }
 
 bool sl_zigbee_af_counters_is_outgoing_response(sl_zigbee_aps_frame_t *apsFrame,
                                                 sl_status_t status)
 {
-  bool isResponse = sl_zigbee_is_incoming_counters_response(apsFrame);
+  bool isResponse = sl_zigbee_af_counters_is_incoming_response(apsFrame);
   if (isResponse
       && apsFrame->clusterId == SL_ZIGBEE_REPORT_AND_CLEAR_COUNTERS_RESPONSE
       && status == SL_STATUS_OK) {
@@ -11,9 +11,9 @@
  * Summary of requirements:
  * - Include counters.c and counters-ota.c in the build on an EmberZNet processor.
  *   Include only counters-ota-host.c in the build on an EZSP host processor.
- * - Call ::sl_zigbee_is_incoming_counters_request() in the incoming message handler.
- * - Call ::sl_zigbee_is_incoming_counters_response() in the incoming message handler.
- * - Call ::sl_zigbee_is_outgoing_counters_response() in the message sent handler.
+ * - Call ::sl_zigbee_af_counters_is_incoming_request() in the incoming message handler.
+ * - Call ::sl_zigbee_af_counters_is_incoming_response() in the incoming message handler.
+ * - Call ::sl_zigbee_af_counters_is_outgoing_response() in the message sent handler.
  *
  * The request and response messages use profile id SL_ZIGBEE_PRIVATE_PROFILE_ID,
  * and the following cluster ids:
@@ -27,6 +27,18 @@
  * non-zero counters.  Each entry in the list consists of the one-byte counter
  * id followed by a two-byte counter, low byte first.  If all entries do not
  * fit into a single payload, multiple response messages are sent.
+ *
+ * With the counter metrics enabled, SL_ZIGBEE_REPORT_COUNTER_METRICS_REQUEST
+ * asks for the rates and histograms of counters-metrics.h instead.  The
+ * request has no payload.  The payload of SL_ZIGBEE_REPORT_COUNTER_METRICS_RESPONSE
+ * is a list of entries of two kinds:
+ * - A rate: the one-byte counter id, the two-byte count of the last complete
+ *   minute and the two-byte count of the last complete hour.  Only counters
+ *   with a non-zero count are listed.
+ * - A histogram: the one-byte histogram id with the high bit set, the one-byte
+ *   number of buckets n, and n two-byte bucket counts.
+ * All two-byte values are sent low byte first.  Rates are sent before
+ * histograms, and an entry is never split between two response messages.
  *******************************************************************************
  * # License
  * <b>Copyright 2018 Silicon Laboratories Inc. www.silabs.com</b>
@@ -68,6 +80,18 @@
  */
 #define MAX_PAYLOAD_LENGTH 48
 
+/** The cluster ID used to request that a node respond with a report of its
+ * counter rates and histograms.  The clusters up to 0x0005 are defined in
+ * sl_zigbee_types.h.
+ */
+#define SL_ZIGBEE_REPORT_COUNTER_METRICS_REQUEST 0x0006u
+
+/** The cluster ID used to respond to an SL_ZIGBEE_REPORT_COUNTER_METRICS_REQUEST. */
+#define SL_ZIGBEE_REPORT_COUNTER_METRICS_RESPONSE 0x8006u
+
+/** Set in the id of a histogram entry of a metrics response. */
+#define SL_ZIGBEE_COUNTER_METRICS_HISTOGRAM_FLAG 0x80u
+
 /**
  * @name API
  * @{
@@ -88,6 +112,15 @@
 sl_status_t sl_zigbee_af_counters_send_request(sl_802154_short_addr_t destination,
                                                bool clearCounters);
 
+/** @brief Send a request to the specified destination to send back a report
+ * of its counter rates and histograms.
+ *
+ * @param[in] destination the address of the node to send the request to.
+ * @return SL_STATUS_OK if the request was successfully submitted for
+ * sending.  See ::sl_zigbee_send_unicast() for possible failure statuses.
+ */
+sl_status_t sl_zigbee_af_counters_send_metrics_request(sl_802154_short_addr_t destination);
+
 /** @brief Call this function at the beginning of
  * the incoming message handler.  It returns true if the incoming
  * message was a counter's request and should be ignored by
@@ -95,8 +128,8 @@ sl_status_t sl_zigbee_af_counters_send_request(sl_802154_short_addr_t destinatio
  *
  * @param[in] apsFrame the APS frame passed to the incoming message handler.
  * @param[in] sender the node ID of the sender of the request.
- * @return true if the message was a counters request and should be
- * ignored by the rest of the incoming message handler.
+ * @return true if the message was a counters or counter metrics request and
+ * should be ignored by the rest of the incoming message handler.
  */
 bool sl_zigbee_af_counters_is_incoming_request(sl_zigbee_aps_frame_t *apsFrame,
                                                sl_802154_short_addr_t sender);
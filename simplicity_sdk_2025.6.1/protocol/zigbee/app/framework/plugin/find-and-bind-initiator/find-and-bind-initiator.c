@@ -18,6 +18,7 @@
 #include "app/framework/include/af.h"
 
 #include "app/framework/util/af-main.h" // sl_zigbee_af_get_binding_table_size
+#include "app/framework/util/service-discovery.h" // SL_ZIGBEE_SUPPORTED_SERVICE_DISCOVERY_STATES_PER_NETWORK
 #ifndef SL_ZIGBEE_SCRIPTED_TEST
 #include "find-and-bind-initiator-config.h"
 #endif
@@ -54,6 +55,35 @@
 
 #define GROUPS_CLUSTER_INVALID_GROUP_ID (0xFFFF)
 
+#ifndef SL_ZIGBEE_AF_PLUGIN_FIND_AND_BIND_INITIATOR_DISCOVERIES_IN_FLIGHT
+  #define SL_ZIGBEE_AF_PLUGIN_FIND_AND_BIND_INITIATOR_DISCOVERIES_IN_FLIGHT 1
+#endif
+#ifndef SL_ZIGBEE_AF_PLUGIN_FIND_AND_BIND_INITIATOR_CACHE_SIZE
+  #define SL_ZIGBEE_AF_PLUGIN_FIND_AND_BIND_INITIATOR_CACHE_SIZE 0
+#endif
+#ifndef SL_ZIGBEE_AF_PLUGIN_FIND_AND_BIND_INITIATOR_CACHE_TTL_S
+  #define SL_ZIGBEE_AF_PLUGIN_FIND_AND_BIND_INITIATOR_CACHE_TTL_S 300
+#endif
+
+#define DISCOVERIES_IN_FLIGHT SL_ZIGBEE_AF_PLUGIN_FIND_AND_BIND_INITIATOR_DISCOVERIES_IN_FLIGHT
+#define CACHE_SIZE            SL_ZIGBEE_AF_PLUGIN_FIND_AND_BIND_INITIATOR_CACHE_SIZE
+#define CACHE_TTL_MS          (SL_ZIGBEE_AF_PLUGIN_FIND_AND_BIND_INITIATOR_CACHE_TTL_S \
+                               * MILLISECOND_TICKS_PER_SECOND)
+
+#if (DISCOVERIES_IN_FLIGHT > SL_ZIGBEE_SUPPORTED_SERVICE_DISCOVERY_STATES_PER_NETWORK)
+  #error "Find and bind discoveries in flight exceed the service discovery states"
+#endif
+
+// Targets are discovered by the pipelined engine below whenever more than one
+// request may be outstanding or results are cached; otherwise the original
+// one-target-at-a-time state machine is used.
+#if (DISCOVERIES_IN_FLIGHT > 1) || (CACHE_SIZE > 0)
+  #define PIPELINED_DISCOVERY
+#endif
+
+// Simple descriptors with more clusters than this are not cached.
+#define CACHE_MAX_CLUSTERS (16)
+
 // -----------------------------------------------------------------------------
 // Globals
 
@@ -71,6 +101,46 @@ static sl_802154_long_addr_t currentTargetResponseIeeeAddr;
 
 static uint8_t initiatorEndpoint = SL_ZIGBEE_AF_INVALID_ENDPOINT;
 
+#ifdef PIPELINED_DISCOVERY
+// Discovery progress of each target. A target moves from a NEEDED step to the
+// matching PENDING step when its request is sent.
+enum {
+  TARGET_IEEE_NEEDED    = 0x00,
+  TARGET_IEEE_PENDING   = 0x01,
+  TARGET_DESCR_NEEDED   = 0x02,
+  TARGET_DESCR_PENDING  = 0x03,
+  TARGET_DONE           = 0x04,
+};
+static uint8_t targetSteps[SL_ZIGBEE_AF_PLUGIN_FIND_AND_BIND_INITIATOR_TARGET_RESPONSES_COUNT];
+static sl_802154_long_addr_t targetIeeeAddrs[SL_ZIGBEE_AF_PLUGIN_FIND_AND_BIND_INITIATOR_TARGET_RESPONSES_COUNT];
+
+// Service discovery callbacks carry no context, and a timed out request does
+// not report the node it was sent to, so every outstanding request owns a slot
+// with its own callback. A slot stays in flight until its callback fires, even
+// if the run that used it has stopped, in which case its target is invalid.
+typedef struct {
+  uint8_t targetIndex;
+  bool inFlight;
+} sli_zigbee_find_and_bind_discovery_slot_t;
+
+static sli_zigbee_find_and_bind_discovery_slot_t discoverySlots[DISCOVERIES_IN_FLIGHT];
+
+#if (CACHE_SIZE > 0)
+typedef struct {
+  bool inUse;
+  sl_802154_short_addr_t nodeId;
+  uint8_t endpoint;
+  uint8_t inClusterCount;
+  uint8_t outClusterCount;
+  uint32_t timestampMs;
+  sl_802154_long_addr_t ieeeAddr;
+  sl_zigbee_af_cluster_id_t clusters[CACHE_MAX_CLUSTERS];
+} sli_zigbee_find_and_bind_cache_entry_t;
+
+static sli_zigbee_find_and_bind_cache_entry_t discoveryCache[CACHE_SIZE];
+#endif // CACHE_SIZE > 0
+#endif // PIPELINED_DISCOVERY
+
 // -----------------------------------------------------------------------------
 // Private API Prototypes
 
@@ -81,16 +151,19 @@ enum {
   FIND_TARGETS  = 0x01,
   IEEE_REQUEST  = 0x02,
   DESCR_REQUEST = 0x03,
+  DISCOVER      = 0x04,
 };
 
 /* state machine */
 static sl_status_t broadcastIdentifyQuery(void);
 
+#ifndef PIPELINED_DISCOVERY
 static sl_status_t sendIeeeAddrRequest(void);
 static void handleIeeeAddrResponse(const sl_zigbee_af_service_discovery_result_t *result);
 
 static sl_status_t sendSimpleDescriptorRequest(void);
 static void handleSimpleDescriptorResponse(const sl_zigbee_af_service_discovery_result_t *result);
+#endif
 static void processClusterList(bool clientList,
                                uint8_t clusterCount,
                                const sl_zigbee_af_cluster_id_t *clusters,
@@ -101,9 +174,31 @@ static sl_status_t writeSimpleDescriptorResponse(sl_zigbee_binding_table_entry_t
 
 static void cleanupAndStop(sl_status_t status);
 
+#ifdef PIPELINED_DISCOVERY
+/* pipelined discovery */
+static void startTargetDiscovery(void);
+static sl_status_t pumpTargetDiscovery(bool *finished);
+static void releaseDiscoverySlots(void);
+static void handleDiscoveryResult(uint8_t slot,
+                                  const sl_zigbee_af_service_discovery_result_t *result);
+static void bindTarget(uint8_t index,
+                       uint8_t inClusterCount,
+                       const sl_zigbee_af_cluster_id_t *inClusters,
+                       uint8_t outClusterCount,
+                       const sl_zigbee_af_cluster_id_t *outClusters);
+#if (CACHE_SIZE > 0)
+static sli_zigbee_find_and_bind_cache_entry_t *cacheFind(sl_802154_short_addr_t nodeId,
+                                                         uint8_t endpoint);
+static void cacheStore(uint8_t index,
+                       const sl_zigbee_af_cluster_list_t *clusterList);
+#endif // CACHE_SIZE > 0
+#endif // PIPELINED_DISCOVERY
+
+#ifndef PIPELINED_DISCOVERY
 /* target responses */
 // get the next index of a response
 static void targetResponsesGetNext();
+#endif
 
 #define targetInfosAreEqual(targetInfo1, targetInfo2) \
   ((targetInfo1).nodeId == (targetInfo2).nodeId       \
@@ -130,6 +225,9 @@ sl_status_t sl_zigbee_af_find_and_bind_initiator_start(uint8_t endpoint)
 
   state = STATE_NONE;
   targetResponsesReceived = 0;
+#ifdef PIPELINED_DISCOVERY
+  releaseDiscoverySlots();
+#endif
 
   status = broadcastIdentifyQuery();
   if (status == SL_STATUS_OK) {
@@ -151,6 +249,27 @@ static void checkTargetResponsesEventHandler(sl_zigbee_af_event_t * event)
   sl_zigbee_af_event_set_inactive(&checkTargetResponsesEvent);
 
   switch (state) {
+#ifdef PIPELINED_DISCOVERY
+    case FIND_TARGETS:
+      if (targetResponsesReceived) {
+        startTargetDiscovery();
+        state = DISCOVER;
+      } else {
+        // If we didn't get any responses to our query, die.
+        status = SL_STATUS_FAIL;
+        break;
+      }
+
+    // FALLTHROUGH
+
+    case DISCOVER:
+      status = pumpTargetDiscovery(&finished);
+      if (status != SL_STATUS_OK || finished) {
+        releaseDiscoverySlots();
+        state = STATE_NONE;
+      }
+      break;
+#else
     case FIND_TARGETS:
       if (targetResponsesReceived) {
         state = IEEE_REQUEST;
@@ -179,6 +298,7 @@ static void checkTargetResponsesEventHandler(sl_zigbee_af_event_t * event)
       status = sendSimpleDescriptorRequest();
       state = FIND_TARGETS;
       break;
+#endif // PIPELINED_DISCOVERY
 
     case STATE_NONE:
     default:
@@ -228,6 +348,11 @@ sl_zigbee_af_zcl_request_status_t sl_zigbee_af_identify_cluster_identify_query_r
         && i == targetResponsesReceived) {
       targetResponses[i].nodeId = currentCommand->source;
       targetResponses[i].endpoint = currentCommand->apsFrame->sourceEndpoint;
+#ifdef PIPELINED_DISCOVERY
+      // A late response can arrive once discovery has started, so the step
+      // left over from a previous run must not be reused.
+      targetSteps[i] = TARGET_IEEE_NEEDED;
+#endif
       targetResponsesReceived++;
     }
   }
@@ -243,6 +368,7 @@ void sli_zigbee_af_find_and_bind_initiator_init_callback(uint8_t init_level)
                           checkTargetResponsesEventHandler);
 }
 
+#ifndef PIPELINED_DISCOVERY
 // -----------------------------------------------------------------------------
 // Target Responses Set (Private) API
 
@@ -261,6 +387,7 @@ static void targetResponsesGetNext()
     currentTargetResponsesIndex = INVALID_TARGET_RESPONSES_INDEX;
   }
 }
+#endif // PIPELINED_DISCOVERY
 
 // -----------------------------------------------------------------------------
 // Private API
@@ -283,6 +410,7 @@ static sl_status_t broadcastIdentifyQuery(void)
   return status;
 }
 
+#ifndef PIPELINED_DISCOVERY
 static sl_status_t sendIeeeAddrRequest(void)
 {
   sl_status_t status;
@@ -368,6 +496,7 @@ static void handleSimpleDescriptorResponse(const sl_zigbee_af_service_discovery_
 
   sl_zigbee_af_event_set_active(&checkTargetResponsesEvent);
 }
+#endif // PIPELINED_DISCOVERY
 
 static void processClusterList(bool clientList,
                                uint8_t clusterCount,
@@ -454,6 +583,298 @@ static sl_status_t writeSimpleDescriptorResponse(sl_zigbee_binding_table_entry_t
   return status;
 }
 
+#ifdef PIPELINED_DISCOVERY
+// -----------------------------------------------------------------------------
+// Pipelined Discovery (Private) API
+
+static void handleDiscoverySlot0Result(const sl_zigbee_af_service_discovery_result_t *result)
+{
+  handleDiscoveryResult(0, result);
+}
+
+static void handleDiscoverySlot1Result(const sl_zigbee_af_service_discovery_result_t *result)
+{
+  handleDiscoveryResult(1, result);
+}
+
+static void handleDiscoverySlot2Result(const sl_zigbee_af_service_discovery_result_t *result)
+{
+  handleDiscoveryResult(2, result);
+}
+
+static void handleDiscoverySlot3Result(const sl_zigbee_af_service_discovery_result_t *result)
+{
+  handleDiscoveryResult(3, result);
+}
+
+static sl_zigbee_af_service_discovery_callback_t * const discoverySlotCallbacks[] = {
+  handleDiscoverySlot0Result,
+  handleDiscoverySlot1Result,
+  handleDiscoverySlot2Result,
+  handleDiscoverySlot3Result,
+};
+
+static void startTargetDiscovery(void)
+{
+  uint8_t i;
+
+  for (i = 0; i < targetResponsesReceived; i++) {
+    targetSteps[i] = TARGET_IEEE_NEEDED;
+  }
+}
+
+// Sends requests for as many targets as there are free slots. The IEEE
+// address of every target is always requested; a cached simple descriptor is
+// used only when that address matches the one it was cached for. Sets
+// finished once every target has been bound.
+static sl_status_t pumpTargetDiscovery(bool *finished)
+{
+  sl_status_t status;
+  uint8_t i, slot;
+  bool slotsInFlight = false;
+#if (CACHE_SIZE > 0)
+  sli_zigbee_find_and_bind_cache_entry_t *entry;
+#endif
+
+  for (slot = 0; slot < DISCOVERIES_IN_FLIGHT; slot++) {
+    slotsInFlight |= discoverySlots[slot].inFlight;
+  }
+
+  *finished = true;
+  for (i = 0; i < targetResponsesReceived; i++) {
+#if (CACHE_SIZE > 0)
+    entry = (targetSteps[i] == TARGET_DESCR_NEEDED
+             ? cacheFind(targetResponses[i].nodeId, targetResponses[i].endpoint)
+             : NULL);
+    if (entry != NULL
+        && !memcmp(targetIeeeAddrs[i], entry->ieeeAddr, EUI64_SIZE)) {
+      debugPrintln("%s: cached descriptor for 0x%04X",
+                   SL_ZIGBEE_AF_PLUGIN_FIND_AND_BIND_INITIATOR_PLUGIN_NAME,
+                   targetResponses[i].nodeId);
+      bindTarget(i,
+                 entry->inClusterCount,
+                 entry->clusters,
+                 entry->outClusterCount,
+                 entry->clusters + entry->inClusterCount);
+      targetSteps[i] = TARGET_DONE;
+    }
+#endif // CACHE_SIZE > 0
+
+    if (targetSteps[i] == TARGET_DONE) {
+      continue;
+    }
+    *finished = false;
+
+    if (targetSteps[i] != TARGET_IEEE_NEEDED
+        && targetSteps[i] != TARGET_DESCR_NEEDED) {
+      continue;
+    }
+    for (slot = 0;
+         slot < DISCOVERIES_IN_FLIGHT && discoverySlots[slot].inFlight;
+         slot++) {
+      ; // pass
+    }
+    if (slot == DISCOVERIES_IN_FLIGHT) {
+      continue;
+    }
+
+    if (targetSteps[i] == TARGET_IEEE_NEEDED) {
+      status = sl_zigbee_af_find_ieee_address(targetResponses[i].nodeId,
+                                              discoverySlotCallbacks[slot]);
+    } else {
+      status = sl_zigbee_af_find_clusters_by_device_and_endpoint(targetResponses[i].nodeId,
+                                                                 targetResponses[i].endpoint,
+                                                                 discoverySlotCallbacks[slot]);
+    }
+
+    debugPrintln("%s: %s request for 0x%04X: 0x%02X",
+                 SL_ZIGBEE_AF_PLUGIN_FIND_AND_BIND_INITIATOR_PLUGIN_NAME,
+                 (targetSteps[i] == TARGET_IEEE_NEEDED ? "Ieee" : "Descriptor"),
+                 targetResponses[i].nodeId,
+                 status);
+
+    if (status != SL_STATUS_OK) {
+      // The service discovery states are shared with the rest of the
+      // application. Wait for one of ours to be released before retrying, but
+      // give up if none of ours is outstanding.
+      if (!slotsInFlight) {
+        return status;
+      }
+      continue;
+    }
+
+    discoverySlots[slot].targetIndex = i;
+    discoverySlots[slot].inFlight = true;
+    slotsInFlight = true;
+    targetSteps[i]++; // NEEDED -> PENDING
+  }
+
+  return SL_STATUS_OK;
+}
+
+// Detaches the outstanding requests from the current run. Their slots are
+// reused only once their callbacks have fired.
+static void releaseDiscoverySlots(void)
+{
+  uint8_t slot;
+
+  for (slot = 0; slot < DISCOVERIES_IN_FLIGHT; slot++) {
+    discoverySlots[slot].targetIndex = INVALID_TARGET_RESPONSES_INDEX;
+  }
+}
+
+static void handleDiscoveryResult(uint8_t slot,
+                                  const sl_zigbee_af_service_discovery_result_t *result)
+{
+  uint8_t index = discoverySlots[slot].targetIndex;
+  const sl_zigbee_af_cluster_list_t *clusterList;
+
+  discoverySlots[slot].targetIndex = INVALID_TARGET_RESPONSES_INDEX;
+  discoverySlots[slot].inFlight = false;
+
+  debugPrintln("%s: slot %d response: 0x%02X",
+               SL_ZIGBEE_AF_PLUGIN_FIND_AND_BIND_INITIATOR_PLUGIN_NAME,
+               slot,
+               result->status);
+
+  if (state != DISCOVER) {
+    return;
+  }
+
+  if (index != INVALID_TARGET_RESPONSES_INDEX
+      && (result->status != SL_ZIGBEE_AF_UNICAST_SERVICE_DISCOVERY_COMPLETE_WITH_RESPONSE
+          || result->responseData == NULL)) {
+    sl_zigbee_af_event_set_inactive(&checkTargetResponsesEvent);
+    releaseDiscoverySlots();
+    state = STATE_NONE;
+    cleanupAndStop(SL_STATUS_FAIL);
+    return;
+  }
+
+  // The event, not this callback, sends the next request, since the service
+  // discovery state of this response is only freed once we return.
+  sl_zigbee_af_event_set_active(&checkTargetResponsesEvent);
+
+  if (index == INVALID_TARGET_RESPONSES_INDEX) {
+    return;
+  }
+
+  if (targetSteps[index] == TARGET_IEEE_PENDING) {
+    memmove(targetIeeeAddrs[index], result->responseData, EUI64_SIZE);
+    targetSteps[index] = TARGET_DESCR_NEEDED;
+  } else {
+    clusterList = (const sl_zigbee_af_cluster_list_t *)(result->responseData);
+    bindTarget(index,
+               clusterList->inClusterCount,
+               clusterList->inClusterList,
+               clusterList->outClusterCount,
+               clusterList->outClusterList);
+    targetSteps[index] = TARGET_DONE;
+#if (CACHE_SIZE > 0)
+    cacheStore(index, clusterList);
+#endif
+  }
+}
+
+static void bindTarget(uint8_t index,
+                       uint8_t inClusterCount,
+                       const sl_zigbee_af_cluster_id_t *inClusters,
+                       uint8_t outClusterCount,
+                       const sl_zigbee_af_cluster_id_t *outClusters)
+{
+  sl_status_t status = SL_STATUS_OK;
+
+  // processClusterList() works on the current target.
+  currentTargetResponsesIndex = index;
+  memmove(currentTargetInfoIeeeAddr, targetIeeeAddrs[index], EUI64_SIZE);
+
+  processClusterList(false, // server list
+                     inClusterCount,
+                     inClusters,
+                     &status);
+  processClusterList(true,  // client list
+                     outClusterCount,
+                     outClusters,
+                     &status);
+
+  currentTargetResponsesIndex = INVALID_TARGET_RESPONSES_INDEX;
+}
+
+#if (CACHE_SIZE > 0)
+// Returns the unexpired entry for this node and endpoint, expiring stale
+// entries along the way.
+static sli_zigbee_find_and_bind_cache_entry_t *cacheFind(sl_802154_short_addr_t nodeId,
+                                                         uint8_t endpoint)
+{
+  uint32_t now = halCommonGetInt32uMillisecondTick();
+  sli_zigbee_find_and_bind_cache_entry_t *found = NULL;
+  uint8_t i;
+
+  for (i = 0; i < CACHE_SIZE; i++) {
+    sli_zigbee_find_and_bind_cache_entry_t *entry = &discoveryCache[i];
+    if (!entry->inUse) {
+      continue;
+    }
+    if (elapsedTimeInt32u(entry->timestampMs, now) >= CACHE_TTL_MS) {
+      entry->inUse = false;
+    } else if (entry->nodeId == nodeId && entry->endpoint == endpoint) {
+      found = entry;
+    }
+  }
+
+  return found;
+}
+
+// Remembers the simple descriptor of a target along with the IEEE address it
+// was discovered for. A descriptor too large to cache drops any older entry for
+// the target. The oldest entry is replaced when the cache is full.
+static void cacheStore(uint8_t index,
+                       const sl_zigbee_af_cluster_list_t *clusterList)
+{
+  sl_802154_short_addr_t nodeId = targetResponses[index].nodeId;
+  uint8_t endpoint = targetResponses[index].endpoint;
+  sli_zigbee_find_and_bind_cache_entry_t *entry = cacheFind(nodeId, endpoint);
+  uint32_t now = halCommonGetInt32uMillisecondTick();
+  uint8_t i;
+
+  if (clusterList->inClusterCount + clusterList->outClusterCount
+      > CACHE_MAX_CLUSTERS) {
+    if (entry != NULL) {
+      entry->inUse = false;
+    }
+    return;
+  }
+
+  if (entry == NULL) {
+    entry = &discoveryCache[0];
+    for (i = 0; i < CACHE_SIZE && discoveryCache[i].inUse; i++) {
+      if (elapsedTimeInt32u(discoveryCache[i].timestampMs, now)
+          > elapsedTimeInt32u(entry->timestampMs, now)) {
+        entry = &discoveryCache[i];
+      }
+    }
+    if (i < CACHE_SIZE) {
+      entry = &discoveryCache[i];
+    }
+    entry->inUse = true;
+    entry->nodeId = nodeId;
+    entry->endpoint = endpoint;
+  }
+
+  memmove(entry->ieeeAddr, targetIeeeAddrs[index], EUI64_SIZE);
+  entry->inClusterCount = clusterList->inClusterCount;
+  entry->outClusterCount = clusterList->outClusterCount;
+  memmove(entry->clusters,
+          clusterList->inClusterList,
+          clusterList->inClusterCount * sizeof(sl_zigbee_af_cluster_id_t));
+  memmove(entry->clusters + clusterList->inClusterCount,
+          clusterList->outClusterList,
+          clusterList->outClusterCount * sizeof(sl_zigbee_af_cluster_id_t));
+  entry->timestampMs = now;
+}
+#endif // CACHE_SIZE > 0
+#endif // PIPELINED_DISCOVERY
+
 static void cleanupAndStop(sl_status_t status)
 {
   debugPrintln("%s: Stop. Status: 0x%02X. State: 0x%02X",
@@ -0,0 +1,92 @@
+/***************************************************************************//**
+ * @file
+ * @brief Tokens for the Network Steering plugin.
+ *******************************************************************************
+ * # License
+ * <b>Copyright 2025 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * The licensor of this software is Silicon Laboratories Inc. Your use of this
+ * software is governed by the terms of Silicon Labs Master Software License
+ * Agreement (MSLA) available at
+ * www.silabs.com/about-us/legal/master-software-license-agreement. This
+ * software is distributed to you in Source Code format and is governed by the
+ * sections of the MSLA applicable to Source Code.
+ *
+ ******************************************************************************/
+
+#include "sl_token_manager_api.h"
+#include "sl_token_manager_defines.h"
+#include "network-steering-config.h"
+
+#if (SL_ZIGBEE_AF_PLUGIN_NETWORK_STEERING_RANK_BEACONS == 1)
+// This header is included several times by the token framework.
+#ifndef NETWORK_STEERING_JOIN_HISTORY_TYPES
+#define NETWORK_STEERING_JOIN_HISTORY_TYPES
+#if !defined(SL_ZIGBEE_AF_PLUGIN_NETWORK_STEERING_JOIN_HISTORY_SIZE)
+  #define SL_ZIGBEE_AF_PLUGIN_NETWORK_STEERING_JOIN_HISTORY_SIZE 4
+#endif
+
+// An entry is unused when its channel is 0.
+typedef struct {
+  uint8_t extendedPanId[EXTENDED_PAN_ID_SIZE];
+  uint8_t channel;
+  uint8_t joinFailures;
+  bool lastJoined;
+} sli_zigbee_af_network_steering_join_history_entry_t;
+
+// The whole history is kept in one token so that it is written at once.
+typedef struct {
+  sli_zigbee_af_network_steering_join_history_entry_t entries[SL_ZIGBEE_AF_PLUGIN_NETWORK_STEERING_JOIN_HISTORY_SIZE];
+} sli_zigbee_af_network_steering_join_history_t;
+#endif // NETWORK_STEERING_JOIN_HISTORY_TYPES
+
+#if (SL_ZIGBEE_AF_PLUGIN_NETWORK_STEERING_PERSIST_JOIN_HISTORY == 1) && !defined(EZSP_HOST)
+#define CREATOR_NETWORK_STEERING_JOIN_HISTORY  (0x8726)
+#define NVM3KEY_NETWORK_STEERING_JOIN_HISTORY (NVM3KEY_DOMAIN_ZIGBEE | 0x8726)
+#define COMMON_TOKEN_NETWORK_STEERING_JOIN_HISTORY SL_TOKEN_GET_DYNAMIC_TOKEN((SL_TOKEN_NVM3_REGION_ZIGBEE | 0x8726), 0)
+
+#define TOKEN_NETWORK_STEERING_JOIN_HISTORY_DEFAULT { { { { 0 } } } }
+
+#ifdef DEFINETOKENS
+// Define the actual token storage information here
+
+DEFINE_BASIC_TOKEN(NETWORK_STEERING_JOIN_HISTORY,
+                   sli_zigbee_af_network_steering_join_history_t,
+                   TOKEN_NETWORK_STEERING_JOIN_HISTORY_DEFAULT)
+
+#endif //DEFINETOKENS
+#endif //(SL_ZIGBEE_AF_PLUGIN_NETWORK_STEERING_PERSIST_JOIN_HISTORY == 1) && !defined(EZSP_HOST)
+#endif //(SL_ZIGBEE_AF_PLUGIN_NETWORK_STEERING_RANK_BEACONS == 1)
+
+#if (SL_ZIGBEE_AF_PLUGIN_NETWORK_STEERING_ADAPTIVE_CHANNEL_ORDER == 1) \
+  && (SL_ZIGBEE_AF_PLUGIN_NETWORK_STEERING_OPTIMIZE_SCANS != 1)
+#ifndef NETWORK_STEERING_CHANNEL_STATS_TYPES
+#define NETWORK_STEERING_CHANNEL_STATS_TYPES
+typedef struct {
+  uint8_t joins;    // Successful joins on the channel, saturating
+  uint8_t activity; // Decaying measure of joinable beacons heard
+  uint8_t scans;    // Steering runs that scanned the channel, saturating
+} sli_zigbee_af_network_steering_channel_stats_t;
+
+// The statistics of all channels are kept in one token so that they are
+// written at once.
+typedef struct {
+  sli_zigbee_af_network_steering_channel_stats_t channels[SL_ZIGBEE_NUM_802_15_4_CHANNELS];
+} sli_zigbee_af_network_steering_channel_history_t;
+#endif // NETWORK_STEERING_CHANNEL_STATS_TYPES
+
+#if !defined(EZSP_HOST)
+#define CREATOR_NETWORK_STEERING_CHANNEL_STATS  (0x8727)
+#define NVM3KEY_NETWORK_STEERING_CHANNEL_STATS (NVM3KEY_DOMAIN_ZIGBEE | 0x8727)
+#define COMMON_TOKEN_NETWORK_STEERING_CHANNEL_STATS SL_TOKEN_GET_DYNAMIC_TOKEN((SL_TOKEN_NVM3_REGION_ZIGBEE | 0x8727), 0)
+
+#define TOKEN_NETWORK_STEERING_CHANNEL_STATS_DEFAULT { { { 0 } } }
+
+#ifdef DEFINETOKENS
+DEFINE_BASIC_TOKEN(NETWORK_STEERING_CHANNEL_STATS,
+                   sli_zigbee_af_network_steering_channel_history_t,
+                   TOKEN_NETWORK_STEERING_CHANNEL_STATS_DEFAULT)
+#endif //DEFINETOKENS
+#endif //!defined(EZSP_HOST)
+#endif //(SL_ZIGBEE_AF_PLUGIN_NETWORK_STEERING_ADAPTIVE_CHANNEL_ORDER == 1) && (SL_ZIGBEE_AF_PLUGIN_NETWORK_STEERING_OPTIMIZE_SCANS != 1)
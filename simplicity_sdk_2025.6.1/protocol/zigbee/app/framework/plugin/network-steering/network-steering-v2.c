@@ -41,6 +41,10 @@
 #include "app/framework/plugin/update-tc-link-key/update-tc-link-key.h"
 #endif
 
+#ifdef RANK_BEACONS
+#include "network-steering-tokens.h"
+#endif
+
 #ifdef SL_ZIGBEE_TEST
   #define HIDDEN
   #define SL_ZIGBEE_AF_PLUGIN_NETWORK_STEERING_RADIO_TX_POWER 3
@@ -145,6 +149,35 @@ static sl_zigbee_beacon_data_t beacon;
 static uint8_t beacon_number = 0;
 static uint32_t current_channel_mask = 0;
 
+#ifdef RANK_BEACONS
+
+#define JOIN_HISTORY_SIZE SL_ZIGBEE_AF_PLUGIN_NETWORK_STEERING_JOIN_HISTORY_SIZE
+
+// A beacon's score starts from its LQI and RSSI and is then adjusted by the
+// depth and capacity it advertises and by what we remember about joining its
+// network before. Beacons are tried from the highest score down.
+#define SCORE_DEPTH_PENALTY          16
+#define SCORE_NO_CAPACITY_PENALTY    128
+#define SCORE_NO_PERMIT_JOIN_PENALTY 256
+#define SCORE_PARENT_BONUS           16
+#define SCORE_JOIN_FAILURE_PENALTY   64
+#define SCORE_LAST_JOINED_BONUS      128
+#define MAX_JOIN_FAILURES            3
+
+static sli_zigbee_af_network_steering_join_history_entry_t joinHistory[JOIN_HISTORY_SIZE];
+static bool joinHistoryDirty = false;
+
+// Stored beacon indices, best candidate first
+static uint8_t beaconOrder[SL_ZIGBEE_MAX_BEACONS_TO_STORE];
+static uint8_t beaconOrderCount = 0;
+
+#ifdef PERSIST_JOIN_HISTORY
+static bool scanningLastJoinedChannel = false;
+static uint8_t lastJoinedChannel = 0;
+#endif // PERSIST_JOIN_HISTORY
+
+#endif // RANK_BEACONS
+
 sl_zigbee_af_event_t sl_zigbee_af_network_steering_finish_steering_event[SL_ZIGBEE_SUPPORTED_NETWORKS];
 #define finishSteeringEvent (sl_zigbee_af_network_steering_finish_steering_event)
 
@@ -188,6 +221,8 @@ static sl_status_t setupSecurity(void);
 static uint32_t jitterTimeDelayMs();
 HIDDEN void scanResultsHandler(sl_zigbee_af_plugin_scan_dispatch_scan_results_t *results);
 static sl_status_t scheduleScan(uint32_t channelMask);
+static sl_status_t scanConfiguredChannels(void);
+static sl_status_t getStoredBeacon(uint8_t beaconNumber, sl_zigbee_beacon_data_t *beaconData);
 
 // Callback declarations for the sake of the compiler during unit tests.
 int8_t sl_zigbee_af_network_steering_get_power_for_radio_channel_cb(uint8_t channel);
@@ -209,6 +244,192 @@ void sli_zigbee_af_network_steering_init_callback(uint8_t init_level)
 
   sl_zigbee_af_network_event_init(finishSteeringEvent,
                                   sl_zigbee_af_network_steering_finish_steering_event_handler);
+
+#ifdef PERSIST_JOIN_HISTORY
+  if (sl_token_manager_get_data(COMMON_TOKEN_NETWORK_STEERING_JOIN_HISTORY,
+                                joinHistory,
+                                sizeof(joinHistory)) != SL_STATUS_OK) {
+    memset(joinHistory, 0, sizeof(joinHistory));
+  }
+#endif
+}
+
+//============================================================================
+// Beacon Ranking
+
+#ifdef RANK_BEACONS
+
+static sli_zigbee_af_network_steering_join_history_entry_t *findJoinHistoryEntry(const uint8_t *extendedPanId)
+{
+  uint8_t i;
+  for (i = 0; i < JOIN_HISTORY_SIZE; i++) {
+    if (joinHistory[i].channel != 0
+        && 0 == memcmp(joinHistory[i].extendedPanId,
+                       extendedPanId,
+                       EXTENDED_PAN_ID_SIZE)) {
+      return &joinHistory[i];
+    }
+  }
+  return NULL;
+}
+
+// Returns the history entry for the beacon's network, claiming a free entry
+// or evicting the network with the most join failures if it is not yet known.
+// The entry of the last joined network is never evicted.
+static sli_zigbee_af_network_steering_join_history_entry_t *getJoinHistoryEntry(const sl_zigbee_beacon_data_t *beaconData)
+{
+  sli_zigbee_af_network_steering_join_history_entry_t *entry;
+  uint8_t i;
+
+  entry = findJoinHistoryEntry(beaconData->extendedPanId);
+  if (entry == NULL) {
+    for (i = 0; i < JOIN_HISTORY_SIZE; i++) {
+      if (joinHistory[i].channel == 0) {
+        entry = &joinHistory[i];
+        break;
+      }
+      if (!joinHistory[i].lastJoined
+          && (entry == NULL
+              || joinHistory[i].joinFailures > entry->joinFailures)) {
+        entry = &joinHistory[i];
+      }
+    }
+    if (entry == NULL) {
+      return NULL;
+    }
+    memcpy(entry->extendedPanId, beaconData->extendedPanId, EXTENDED_PAN_ID_SIZE);
+    entry->joinFailures = 0;
+    entry->lastJoined = false;
+  }
+  entry->channel = beaconData->channel;
+  return entry;
+}
+
+static void recordJoinResult(const sl_zigbee_beacon_data_t *beaconData, bool joined)
+{
+  sli_zigbee_af_network_steering_join_history_entry_t *entry;
+  uint8_t i;
+
+  entry = getJoinHistoryEntry(beaconData);
+  if (entry == NULL) {
+    return;
+  }
+
+  if (joined) {
+    for (i = 0; i < JOIN_HISTORY_SIZE; i++) {
+      joinHistory[i].lastJoined = false;
+    }
+    entry->lastJoined = true;
+    entry->joinFailures = 0;
+  } else if (entry->joinFailures < MAX_JOIN_FAILURES) {
+    entry->joinFailures++;
+  }
+  joinHistoryDirty = true;
+}
+
+// Join failures are only written back when steering stops or succeeds, so
+// that trying a long list of candidates does not wear the flash.
+static void saveJoinHistory(void)
+{
+  if (!joinHistoryDirty) {
+    return;
+  }
+#ifdef PERSIST_JOIN_HISTORY
+  (void)sl_token_manager_set_data(COMMON_TOKEN_NETWORK_STEERING_JOIN_HISTORY,
+                                  joinHistory,
+                                  sizeof(joinHistory));
+#endif
+  joinHistoryDirty = false;
+}
+
+static int16_t beaconScore(const sl_zigbee_beacon_data_t *beaconData)
+{
+  const sli_zigbee_af_network_steering_join_history_entry_t *entry;
+  int16_t score = (int16_t)beaconData->lqi + beaconData->rssi;
+
+  score -= (int16_t)beaconData->depth * SCORE_DEPTH_PENALTY;
+  if (!beaconData->hasCapacity) {
+    score -= SCORE_NO_CAPACITY_PENALTY;
+  }
+  if (!beaconData->permitJoin) {
+    score -= SCORE_NO_PERMIT_JOIN_PENALTY;
+  }
+  if (beaconData->tcConnectivity) {
+    score += SCORE_PARENT_BONUS;
+  }
+  if (beaconData->longUptime) {
+    score += SCORE_PARENT_BONUS;
+  }
+
+  entry = findJoinHistoryEntry(beaconData->extendedPanId);
+  if (entry != NULL) {
+    score -= (int16_t)entry->joinFailures * SCORE_JOIN_FAILURE_PENALTY;
+    if (entry->lastJoined) {
+      score += SCORE_LAST_JOINED_BONUS;
+    }
+  }
+  return score;
+}
+
+// Sorts the stored beacons by score. Beacons with equal scores keep the order
+// in which they were heard.
+static void rankStoredBeacons(void)
+{
+  int16_t scores[COUNTOF(beaconOrder)];
+  sl_zigbee_beacon_data_t candidate;
+  uint8_t count = sl_zigbee_get_num_stored_beacons();
+  uint8_t i, j;
+  int16_t score;
+
+  if (count > COUNTOF(beaconOrder)) {
+    count = COUNTOF(beaconOrder);
+  }
+
+  beaconOrderCount = 0;
+  for (i = 0; i < count; i++) {
+    if (sl_zigbee_get_stored_beacon(i, &candidate) != SL_STATUS_OK) {
+      break;
+    }
+    score = beaconScore(&candidate);
+    for (j = beaconOrderCount; j > 0 && scores[j - 1] < score; j--) {
+      scores[j] = scores[j - 1];
+      beaconOrder[j] = beaconOrder[j - 1];
+    }
+    scores[j] = score;
+    beaconOrder[j] = i;
+    beaconOrderCount++;
+  }
+}
+
+#ifdef PERSIST_JOIN_HISTORY
+static uint8_t getLastJoinedChannel(void)
+{
+  uint32_t channelMask = (sli_zigbee_af_network_steering_primary_channel_mask
+                          | sli_zigbee_af_network_steering_secondary_channel_mask);
+  uint8_t i;
+  for (i = 0; i < JOIN_HISTORY_SIZE; i++) {
+    if (joinHistory[i].lastJoined
+        && (BIT32(joinHistory[i].channel) & channelMask)) {
+      return joinHistory[i].channel;
+    }
+  }
+  return 0;
+}
+#endif // PERSIST_JOIN_HISTORY
+
+#endif // RANK_BEACONS
+
+// Returns the stored beacon at the given position in the order in which
+// candidates are tried.
+static sl_status_t getStoredBeacon(uint8_t beaconNumber, sl_zigbee_beacon_data_t *beaconData)
+{
+#ifdef RANK_BEACONS
+  if (beaconNumber >= beaconOrderCount) {
+    return SL_STATUS_NOT_FOUND;
+  }
+  beaconNumber = beaconOrder[beaconNumber];
+#endif
+  return sl_zigbee_get_stored_beacon(beaconNumber, beaconData);
 }
 
 //============================================================================
@@ -248,7 +469,7 @@ void tryToJoinNetwork()
   while ((!(current_channel_mask & BIT32(beacon.channel)))
          || filteredOut) {
     beacon_number++;
-    status = sl_zigbee_get_stored_beacon(beacon_number, &beacon);
+    status = getStoredBeacon(beacon_number, &beacon);
 
     if (status != SL_STATUS_OK) {
       break;
@@ -361,6 +582,10 @@ void sli_zigbee_af_network_steering_stack_status_callback(sl_status_t status)
     }
   } else if (status == SL_STATUS_NETWORK_UP) {
     sl_zigbee_af_core_println("%s network joined.", PLUGIN_NAME);
+#ifdef RANK_BEACONS
+    recordJoinResult(&beacon, true);
+    saveJoinHistory();
+#endif
     if (!sli_zigbee_af_network_steering_state_uses_distributed_key()
         && !(sli_zigbee_af_network_steering_options_mask
              & SL_ZIGBEE_AF_PLUGIN_NETWORK_STEERING_OPTIONS_NO_TCLK_UPDATE)
@@ -372,9 +597,12 @@ void sli_zigbee_af_network_steering_stack_status_callback(sl_status_t status)
     if (sli_zigbee_af_network_steering_state > SL_ZIGBEE_AF_PLUGIN_NETWORK_STEERING_STATE_NONE
         && sli_zigbee_af_network_steering_state < SL_ZIGBEE_AF_PLUGIN_NETWORK_STEERING_STATE_SCAN_FINISHED) {
       sl_zigbee_af_core_println("%s trying next network.", PLUGIN_NAME);
+#ifdef RANK_BEACONS
+      recordJoinResult(&beacon, false);
+#endif
 
       beacon_number++;
-      status = sl_zigbee_get_stored_beacon(beacon_number, &beacon);
+      status = getStoredBeacon(beacon_number, &beacon);
       if (status != SL_STATUS_OK) {
         sl_zigbee_af_core_println("No beacons left on current mask. "
                                   "Moving to next state");
@@ -430,11 +658,29 @@ static sl_status_t scheduleScan(uint32_t channelMask)
                             PLUGIN_NAME,
                             channelMask == sli_zigbee_af_network_steering_primary_channel_mask
                             ? "primary"
-                            : "secondary",
+                            : (channelMask == sli_zigbee_af_network_steering_secondary_channel_mask
+                               ? "secondary"
+                               : "last joined"),
                             channelMask);
   return status;
 }
 
+// Starts scanning the primary channel mask, or the secondary one if there is
+// no primary mask
+static sl_status_t scanConfiguredChannels(void)
+{
+  uint32_t channelsToScan;
+
+  if (sli_zigbee_af_network_steering_primary_channel_mask) {
+    sli_zigbee_af_network_steering_state = getFirstPrimaryState();
+    channelsToScan = sli_zigbee_af_network_steering_primary_channel_mask;
+  } else {
+    sli_zigbee_af_network_steering_state = getFirstSecondaryState();
+    channelsToScan = sli_zigbee_af_network_steering_secondary_channel_mask;
+  }
+  return scheduleScan(channelsToScan);
+}
+
 // This function is called after a channel mask has been scanned
 HIDDEN void scanResultsHandler(sl_zigbee_af_plugin_scan_dispatch_scan_results_t *results)
 {
@@ -460,6 +706,13 @@ HIDDEN void scanResultsHandler(sl_zigbee_af_plugin_scan_dispatch_scan_results_t
     if (sli_zigbee_af_network_steering_total_beacons) {
       stateMachineRun();
     } else {
+#ifdef PERSIST_JOIN_HISTORY
+      if (scanningLastJoinedChannel) {
+        scanningLastJoinedChannel = false;
+        (void)scanConfiguredChannels();
+        return;
+      }
+#endif
       switch (sli_zigbee_af_network_steering_state) {
         case SL_ZIGBEE_AF_PLUGIN_NETWORK_STEERING_STATE_SCAN_SECONDARY_CONFIGURED:
         case SL_ZIGBEE_AF_PLUGIN_NETWORK_STEERING_STATE_SCAN_SECONDARY_INSTALL_CODE:
@@ -485,6 +738,15 @@ HIDDEN void scanResultsHandler(sl_zigbee_af_plugin_scan_dispatch_scan_results_t
 static sl_status_t goToNextState(void)
 {
   if (sli_zigbee_af_network_steering_state == getLastPrimaryState()) {
+#ifdef PERSIST_JOIN_HISTORY
+    // Nothing could be joined on the last joined channel, so go through the
+    // states again with a scan of the configured channel masks
+    if (scanningLastJoinedChannel) {
+      scanningLastJoinedChannel = false;
+      (void)scanConfiguredChannels();
+      return SL_STATUS_MAC_SCANNING;
+    }
+#endif
     // Skip over SL_ZIGBEE_AF_PLUGIN_NETWORK_STEERING_STATE_SCAN_SECONDARY_CONFIGURED
     // unless a preconfigured key has been set
     sli_zigbee_af_network_steering_state = getFirstSecondaryState();
@@ -533,6 +795,12 @@ static void cleanupAndStop(sl_status_t status)
   sli_zigbee_af_network_steering_join_attempts = 0;
   sli_zigbee_af_network_steering_total_beacons = 0;
   sl_zigbee_af_event_set_inactive(finishSteeringEvent);
+#ifdef RANK_BEACONS
+  saveJoinHistory();
+#endif
+#ifdef PERSIST_JOIN_HISTORY
+  scanningLastJoinedChannel = false;
+#endif
 }
 
 // This function is called only on state transitions. This function sets up
@@ -578,10 +846,21 @@ static void stateMachineRun(void)
       current_channel_mask = sli_zigbee_af_network_steering_secondary_channel_mask;
       break;
   }
+#ifdef PERSIST_JOIN_HISTORY
+  if (scanningLastJoinedChannel) {
+    current_channel_mask = BIT32(lastJoinedChannel);
+  }
+#endif
+
+#ifdef RANK_BEACONS
+  // Rank again on every state, as failed attempts in the previous state may
+  // have changed the scores
+  rankStoredBeacons();
+#endif
 
   // Clear our stored beacon so we can iterate from the start
   beacon_number = 0;
-  status = sl_zigbee_get_stored_beacon(beacon_number, &beacon);
+  status = getStoredBeacon(beacon_number, &beacon);
 
   if (status != SL_STATUS_OK) {
     cleanupAndStop(SL_STATUS_FAIL);
@@ -686,7 +965,6 @@ static sl_status_t setupSecurity(void)
 sl_status_t sl_zigbee_af_network_steering_start(void)
 {
   sl_status_t status = SL_STATUS_INVALID_STATE;
-  uint32_t channelsToScan;
 
   if ((0 == sli_zigbee_af_network_steering_primary_channel_mask)
       && (0 == sli_zigbee_af_network_steering_secondary_channel_mask)) {
@@ -698,18 +976,24 @@ sl_status_t sl_zigbee_af_network_steering_start(void)
           == SL_ZIGBEE_AF_PLUGIN_NETWORK_STEERING_STATE_NONE)) {
     if (sl_zigbee_af_network_state() == SL_ZIGBEE_NO_NETWORK) {
       sl_zigbee_af_add_to_current_app_tasks_cb(SL_ZIGBEE_AF_WAITING_FOR_TC_KEY_UPDATE);
-      if (sli_zigbee_af_network_steering_primary_channel_mask) {
-        sli_zigbee_af_network_steering_state = getFirstPrimaryState();
-        channelsToScan = sli_zigbee_af_network_steering_primary_channel_mask;
-      } else {
-        sli_zigbee_af_network_steering_state = getFirstSecondaryState();
-        channelsToScan = sli_zigbee_af_network_steering_secondary_channel_mask;
-      }
 
       // Stop any previous trust center link key update.
       sl_zigbee_af_update_tc_link_key_stop();
 
-      status = scheduleScan(channelsToScan);
+#ifdef PERSIST_JOIN_HISTORY
+      // Look for the last joined network on its own channel first. This is
+      // much shorter than scanning the full masks and, with the ranking, puts
+      // that network at the top of the candidates.
+      lastJoinedChannel = getLastJoinedChannel();
+      if (lastJoinedChannel != 0) {
+        scanningLastJoinedChannel = true;
+        sli_zigbee_af_network_steering_state = getFirstPrimaryState();
+        status = scheduleScan(BIT32(lastJoinedChannel));
+      } else
+#endif
+      {
+        status = scanConfiguredChannels();
+      }
     } else {
 #ifdef SL_CATALOG_ZIGBEE_TEST_HARNESS_Z3_PRESENT
       // The test harness needs to set up the correct link key
@@ -46,6 +46,9 @@
 #ifndef OPTIMIZE_SCANS
 
 #include "app/framework/plugin/scan-dispatch/scan-dispatch.h"
+#ifdef ADAPTIVE_CHANNEL_ORDER
+#include "network-steering-tokens.h"
+#endif
 #include "app/framework/plugin/update-tc-link-key/update-tc-link-key.h"
 
 #ifdef SL_CATALOG_ZIGBEE_TEST_HARNESS_Z3_PRESENT
@@ -155,6 +158,35 @@ sl_zigbee_key_data_t sl_zigbee_plugin_network_steering_distributed_key;
 
 static uint32_t currentChannelMask = 0;
 
+#ifdef ADAPTIVE_CHANNEL_ORDER
+
+#if !defined(SL_ZIGBEE_AF_PLUGIN_NETWORK_STEERING_SHORT_SCAN_DURATION)
+  #define SL_ZIGBEE_AF_PLUGIN_NETWORK_STEERING_SHORT_SCAN_DURATION 2
+#endif
+
+// Added to a channel's activity every steering run in which joinable beacons
+// are heard on it. Activity halves at the end of every run that scans the
+// channel, so a channel becomes quiet again after eight runs without beacons.
+#define CHANNEL_ACTIVITY_WEIGHT 128
+
+// Restored from the NETWORK_STEERING_CHANNEL_STATS token on an SoC and
+// written back at the end of every steering run.
+static sli_zigbee_af_network_steering_channel_history_t channelHistory;
+#define channelStatsFor(channel) \
+  (&channelHistory.channels[(channel) - SL_ZIGBEE_MIN_802_15_4_CHANNEL_NUMBER])
+
+// Channels scanned, and channels with joinable beacons, in the current run
+static uint32_t scannedChannels = 0;
+static uint32_t activeChannels = 0;
+// Channels with equal statistics are scanned going up from this one
+static uint8_t firstChannel = SL_ZIGBEE_MIN_802_15_4_CHANNEL_NUMBER;
+static bool scanningPrimaryMask = false;
+static bool steeringTimeReported = true;
+static uint32_t steeringStartMs = 0;
+static uint32_t expectedSteeringTimeMs = 0;
+
+#endif // ADAPTIVE_CHANNEL_ORDER
+
 sl_zigbee_af_event_t sl_zigbee_af_network_steering_finish_steering_event[SL_ZIGBEE_SUPPORTED_NETWORKS];
 #define finishSteeringEvent (sl_zigbee_af_network_steering_finish_steering_event)
 void sl_zigbee_af_network_steering_finish_steering_event_handler(sl_zigbee_af_event_t * event);
@@ -205,8 +237,136 @@ void sli_zigbee_af_network_steering_init_callback(uint8_t init_level)
 
   sl_zigbee_af_network_event_init(finishSteeringEvent,
                                   sl_zigbee_af_network_steering_finish_steering_event_handler);
+
+#if defined(ADAPTIVE_CHANNEL_ORDER) && !defined(EZSP_HOST)
+  if (sl_token_manager_get_data(COMMON_TOKEN_NETWORK_STEERING_CHANNEL_STATS,
+                                &channelHistory,
+                                sizeof(channelHistory)) != SL_STATUS_OK) {
+    memset(&channelHistory, 0, sizeof(channelHistory));
+  }
+#endif
 }
 
+//============================================================================
+// Channel Statistics
+
+#ifdef ADAPTIVE_CHANNEL_ORDER
+
+static bool channelIsQuiet(uint8_t channel)
+{
+  const sli_zigbee_af_network_steering_channel_stats_t *stats = channelStatsFor(channel);
+  return (stats->scans != 0 && stats->joins == 0 && stats->activity == 0);
+}
+
+// Quiet channels get a short scan on the primary channel mask. Scans of the
+// secondary mask always use the full duration, so a network that has shown up
+// on a quiet channel is still found.
+static uint8_t getScanDuration(uint8_t channel, bool primaryMask)
+{
+  if (primaryMask
+      && channelIsQuiet(channel)
+      && (SL_ZIGBEE_AF_PLUGIN_NETWORK_STEERING_SHORT_SCAN_DURATION
+          < SL_ZIGBEE_AF_PLUGIN_NETWORK_STEERING_SCAN_DURATION)) {
+    return SL_ZIGBEE_AF_PLUGIN_NETWORK_STEERING_SHORT_SCAN_DURATION;
+  }
+  return SL_ZIGBEE_AF_PLUGIN_NETWORK_STEERING_SCAN_DURATION;
+}
+
+// A scan lasts ((2^duration) + 1) scan periods of 960 symbols of 16 us.
+static uint32_t getScanTimeMs(uint8_t duration)
+{
+  return ((((uint32_t)1 << duration) + 1) * 960 * 16) / 1000;
+}
+
+static uint16_t getChannelScore(uint8_t channel)
+{
+  const sli_zigbee_af_network_steering_channel_stats_t *stats = channelStatsFor(channel);
+  return (uint16_t)((stats->joins << 8) | stats->activity);
+}
+
+static uint8_t getBestChannel(uint32_t channelMask)
+{
+  uint8_t best = 0;
+  uint16_t bestScore = 0;
+  uint8_t channel;
+  uint8_t i;
+
+  for (i = 0; i < SL_ZIGBEE_NUM_802_15_4_CHANNELS; i++) {
+    channel = (SL_ZIGBEE_MIN_802_15_4_CHANNEL_NUMBER
+               + ((firstChannel - SL_ZIGBEE_MIN_802_15_4_CHANNEL_NUMBER + i)
+                  % SL_ZIGBEE_NUM_802_15_4_CHANNELS));
+    if ((BIT32(channel) & channelMask)
+        && (best == 0 || getChannelScore(channel) > bestScore)) {
+      best = channel;
+      bestScore = getChannelScore(channel);
+    }
+  }
+  return best;
+}
+
+// The expected scan time covers the primary mask, in channel order, up to and
+// including the first channel that has been joined before. This is the scan
+// time of a run that joins the same network again on its first attempt.
+static uint32_t estimateSteeringTimeMs(void)
+{
+  uint32_t channelMask = sli_zigbee_af_network_steering_primary_channel_mask;
+  uint32_t timeMs = 0;
+  uint8_t channel;
+
+  while ((channel = getBestChannel(channelMask)) != 0) {
+    channelMask &= ~BIT32(channel);
+    timeMs += getScanTimeMs(getScanDuration(channel, true));
+    if (channelStatsFor(channel)->joins != 0) {
+      break;
+    }
+  }
+  return timeMs;
+}
+
+static void reportSteeringTime(void)
+{
+  if (steeringTimeReported) {
+    return;
+  }
+  sl_zigbee_af_core_println("%s steering time: %d ms (expected scan time %d ms)",
+                            PLUGIN_NAME,
+                            elapsedTimeInt32u(steeringStartMs,
+                                              halCommonGetInt32uMillisecondTick()),
+                            expectedSteeringTimeMs);
+  steeringTimeReported = true;
+}
+
+static void updateChannelStats(void)
+{
+  sli_zigbee_af_network_steering_channel_stats_t *stats;
+  uint8_t channel;
+
+  for (channel = SL_ZIGBEE_MIN_802_15_4_CHANNEL_NUMBER;
+       channel <= SL_ZIGBEE_MAX_802_15_4_CHANNEL_NUMBER;
+       channel++) {
+    if (!(BIT32(channel) & scannedChannels)) {
+      continue;
+    }
+    stats = channelStatsFor(channel);
+    stats->activity >>= 1;
+    if (BIT32(channel) & activeChannels) {
+      stats->activity += CHANNEL_ACTIVITY_WEIGHT;
+    }
+    if (stats->scans < 0xFF) {
+      stats->scans++;
+    }
+  }
+  scannedChannels = 0;
+  activeChannels = 0;
+#if !defined(EZSP_HOST)
+  (void)sl_token_manager_set_data(COMMON_TOKEN_NETWORK_STEERING_CHANNEL_STATS,
+                                  &channelHistory,
+                                  sizeof(channelHistory));
+#endif
+}
+
+#endif // ADAPTIVE_CHANNEL_ORDER
+
 //============================================================================
 // State Machine
 
@@ -281,7 +441,13 @@ static void gotoNextChannel(void)
 
   scanData.scanType = SL_ZIGBEE_ACTIVE_SCAN;
   scanData.channelMask = BIT32(sli_zigbee_af_network_steering_current_channel);
+#ifdef ADAPTIVE_CHANNEL_ORDER
+  scannedChannels |= BIT32(sli_zigbee_af_network_steering_current_channel);
+  scanData.duration = getScanDuration(sli_zigbee_af_network_steering_current_channel,
+                                      scanningPrimaryMask);
+#else
   scanData.duration = SL_ZIGBEE_AF_PLUGIN_NETWORK_STEERING_SCAN_DURATION;
+#endif
   scanData.handler = scanResultsHandler;
   status = sl_zigbee_af_scan_dispatch_schedule_scan(&scanData);
 
@@ -352,6 +518,12 @@ void sli_zigbee_af_network_steering_stack_status_callback(sl_status_t status)
     return;
   } else if (status == SL_STATUS_NETWORK_UP) {
     sl_zigbee_af_core_println("%s network joined.", PLUGIN_NAME);
+#ifdef ADAPTIVE_CHANNEL_ORDER
+    if (channelStatsFor(sli_zigbee_af_network_steering_current_channel)->joins < 0xFF) {
+      channelStatsFor(sli_zigbee_af_network_steering_current_channel)->joins++;
+    }
+    reportSteeringTime();
+#endif
     if (!sli_zigbee_af_network_steering_state_uses_distributed_key()
         && !(sli_zigbee_af_network_steering_options_mask
              & SL_ZIGBEE_AF_PLUGIN_NETWORK_STEERING_OPTIONS_NO_TCLK_UPDATE)) {
@@ -389,6 +561,10 @@ static void networkFoundCallback(sl_zigbee_zigbee_network_t *networkFound,
     return;
   }
 
+#ifdef ADAPTIVE_CHANNEL_ORDER
+  activeChannels |= BIT32(networkFound->channel);
+#endif
+
   debugPrint("%s nwk found ch: %d, panID 0x%04X, xpan: ",
              PLUGIN_NAME,
              networkFound->channel,
@@ -445,6 +621,10 @@ static sl_status_t tryNextMethod(void)
 static void cleanupAndStop(sl_status_t status)
 {
   sl_zigbee_af_core_println("%s Stop.  Cleaning up.", PLUGIN_NAME);
+#ifdef ADAPTIVE_CHANNEL_ORDER
+  reportSteeringTime();
+  updateChannelStats();
+#endif
   sl_zigbee_af_network_steering_complete_cb(status,
                                             sli_zigbee_af_network_steering_total_beacons,
                                             sli_zigbee_af_network_steering_join_attempts,
@@ -458,6 +638,13 @@ static void cleanupAndStop(sl_status_t status)
 
 static uint8_t getNextChannel(void)
 {
+#ifdef ADAPTIVE_CHANNEL_ORDER
+  uint8_t channel = getBestChannel(currentChannelMask);
+  if (channel != 0) {
+    currentChannelMask &= ~BIT32(channel);
+  }
+  return channel;
+#else
   if (sli_zigbee_af_network_steering_current_channel == 0) {
     sli_zigbee_af_network_steering_current_channel = (sl_zigbee_get_pseudo_random_number() & 0x0F)
                                                      + SL_ZIGBEE_MIN_802_15_4_CHANNEL_NUMBER;
@@ -476,6 +663,7 @@ static uint8_t getNextChannel(void)
     }
   }
   return 0;
+#endif // ADAPTIVE_CHANNEL_ORDER
 }
 
 static sl_status_t stateMachineRun(void)
@@ -498,9 +686,15 @@ static sl_status_t stateMachineRun(void)
     case SL_ZIGBEE_AF_PLUGIN_NETWORK_STEERING_STATE_SCAN_PRIMARY_CENTRALIZED:
     case SL_ZIGBEE_AF_PLUGIN_NETWORK_STEERING_STATE_SCAN_PRIMARY_DISTRIBUTED:
       currentChannelMask = sli_zigbee_af_network_steering_primary_channel_mask;
+#ifdef ADAPTIVE_CHANNEL_ORDER
+      scanningPrimaryMask = true;
+#endif
       break;
     default:
       currentChannelMask = sli_zigbee_af_network_steering_secondary_channel_mask;
+#ifdef ADAPTIVE_CHANNEL_ORDER
+      scanningPrimaryMask = false;
+#endif
       break;
   }
 
@@ -581,6 +775,14 @@ sl_status_t sl_zigbee_af_network_steering_start(void)
       // Stop any previous trust center link key update.
       sl_zigbee_af_update_tc_link_key_stop();
 
+#ifdef ADAPTIVE_CHANNEL_ORDER
+      firstChannel = (sl_zigbee_get_pseudo_random_number() & 0x0F)
+                     + SL_ZIGBEE_MIN_802_15_4_CHANNEL_NUMBER;
+      expectedSteeringTimeMs = estimateSteeringTimeMs();
+      steeringStartMs = halCommonGetInt32uMillisecondTick();
+      steeringTimeReported = false;
+#endif
+
       status = stateMachineRun();
     } else {
       status = sl_zigbee_af_permit_join(SL_ZIGBEE_AF_PLUGIN_NETWORK_STEERING_COMMISSIONING_TIME_S,
@@ -44,6 +44,18 @@ extern "C" {
 #if (SL_ZIGBEE_AF_PLUGIN_NETWORK_STEERING_ENABLE_AUTOSTART == 1)
 #define ENABLE_STEERING_AUTOSTART
 #endif
+#if (SL_ZIGBEE_AF_PLUGIN_NETWORK_STEERING_RANK_BEACONS == 1)
+#define RANK_BEACONS
+#if (SL_ZIGBEE_AF_PLUGIN_NETWORK_STEERING_PERSIST_JOIN_HISTORY == 1) && !defined(EZSP_HOST)
+#define PERSIST_JOIN_HISTORY
+#endif
+#endif
+#if (SL_ZIGBEE_AF_PLUGIN_NETWORK_STEERING_ADAPTIVE_CHANNEL_ORDER == 1)
+#ifdef OPTIMIZE_SCANS
+#error "Network Steering: Adaptive channel order requires Optimize scans to be disabled"
+#endif
+#define ADAPTIVE_CHANNEL_ORDER
+#endif
 
 /**
  * @defgroup network-steering Network Steering
@@ -108,6 +108,24 @@ void sli_zigbee_af_reporting_cli_clear_last_report_time(sl_cli_command_arg_t *ar
   sl_zigbee_af_reporting_println("clearing last report time of all attributes");
 }
 
+// plugin reporting stats
+void sli_zigbee_af_reporting_cli_stats(sl_cli_command_arg_t *arguments)
+{
+  sl_zigbee_af_reporting_println("coalesce window: %d ms",
+                                 SL_ZIGBEE_AF_PLUGIN_REPORTING_COALESCE_WINDOW_MS);
+  sl_zigbee_af_reporting_println("commands sent: %d", sli_zigbee_af_reporting_stats.frames);
+  sl_zigbee_af_reporting_println("records sent: %d", sli_zigbee_af_reporting_stats.records);
+  sl_zigbee_af_reporting_println("records pulled forward: %d",
+                                 sli_zigbee_af_reporting_stats.pulledForward);
+}
+
+// plugin reporting clear-stats
+void sli_zigbee_af_reporting_cli_clear_stats(sl_cli_command_arg_t *arguments)
+{
+  memset(&sli_zigbee_af_reporting_stats, 0, sizeof(sli_zigbee_af_reporting_stats));
+  sl_zigbee_af_reporting_println("clearing reporting statistics");
+}
+
 void sl_zigbee_af_reporting_init_cb(uint8_t init_level);
 
 static uint16_t rawTableScan(uint16_t numEntries)
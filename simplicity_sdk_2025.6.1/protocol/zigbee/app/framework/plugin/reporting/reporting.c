@@ -75,6 +75,7 @@ void sl_zigbee_af_reporting_tick_event_handler(sl_zigbee_af_event_t * event);
 #define slxu_zigbee_event_init(x, y) sl_zigbee_af_event_init(x, y)
 
 sli_zigbee_af_report_volatile_data_type sli_zigbee_af_report_volatile_data[REPORT_TABLE_SIZE];
+sli_zigbee_af_reporting_stats_type sli_zigbee_af_reporting_stats;
 
 static void retrySendReport(sl_zigbee_outgoing_message_type_t type,
                             uint16_t indexOrDestination,
@@ -215,141 +216,218 @@ uint16_t sli_zigbee_af_reporting_num_entries(void)
   return reportTableActiveLength;
 }
 
+// Returns true if the entry is ready to be reported. We will only send reports
+// for active reported attributes and only if a reportable change has occurred
+// and the minimum interval has elapsed or if the maximum interval is set and
+// will elapse within slackMs.
+static bool reportIsDue(const sl_zigbee_af_plugin_reporting_entry_t *entry,
+                        uint16_t index,
+                        uint32_t nowMs,
+                        uint32_t slackMs)
+{
+  uint32_t elapsedMs = elapsedTimeInt32u(sli_zigbee_af_report_volatile_data[index].lastReportTimeMs,
+                                         nowMs);
+  if (!sl_zigbee_af_endpoint_is_enabled(entry->endpoint)
+      || entry->direction != SL_ZIGBEE_ZCL_REPORTING_DIRECTION_REPORTED
+      || (elapsedMs
+          < entry->data.reported.minInterval * MILLISECOND_TICKS_PER_SECOND)) {
+    return false;
+  }
+  if (sli_zigbee_af_report_volatile_data[index].reportableChange) {
+    return true;
+  }
+  return (entry->data.reported.maxInterval != 0
+          && (elapsedMs + slackMs
+              >= (entry->data.reported.maxInterval
+                  * MILLISECOND_TICKS_PER_SECOND)));
+}
+
+// Entries that share the source endpoint, cluster, direction and manufacturer
+// code go to the same bindings and can be packed in one Report Attributes
+// command.
+static bool reportsShareCommand(const sl_zigbee_af_plugin_reporting_entry_t *entry1,
+                                const sl_zigbee_af_plugin_reporting_entry_t *entry2)
+{
+  return (entry1->endpoint == entry2->endpoint
+          && entry1->clusterId == entry2->clusterId
+          && (sl_zigbee_af_cluster_is_client(entry1)
+              == sl_zigbee_af_cluster_is_client(entry2))
+          && entry1->manufacturerCode == entry2->manufacturerCode);
+}
+
+#if (SL_ZIGBEE_AF_PLUGIN_REPORTING_COALESCE_WINDOW_MS > 0)
+// Mark entries whose maximum interval expires within the coalescing window
+// as pending when a report is already going out on the same command, so they
+// do not cost a separate transmission a moment later.
+static void pullForwardReports(uint32_t nowMs)
+{
+  uint16_t i, j;
+  for (i = 0; i < reportTableActiveLength; i++) {
+    sl_zigbee_af_plugin_reporting_entry_t entry;
+    if (sli_zigbee_af_report_volatile_data[i].reportPending) {
+      continue;
+    }
+    sli_zigbee_af_reporting_get_entry(i, &entry);
+    if (!reportIsDue(&entry, i, nowMs, SL_ZIGBEE_AF_PLUGIN_REPORTING_COALESCE_WINDOW_MS)) {
+      continue;
+    }
+    for (j = 0; j < reportTableActiveLength; j++) {
+      sl_zigbee_af_plugin_reporting_entry_t other;
+      if (!sli_zigbee_af_report_volatile_data[j].reportPending) {
+        continue;
+      }
+      sli_zigbee_af_reporting_get_entry(j, &other);
+      if (reportsShareCommand(&entry, &other)) {
+        sli_zigbee_af_report_volatile_data[i].reportPending = true;
+        sli_zigbee_af_reporting_stats.pulledForward++;
+        break;
+      }
+    }
+  }
+}
+#endif // SL_ZIGBEE_AF_PLUGIN_REPORTING_COALESCE_WINDOW_MS > 0
+
 void sl_zigbee_af_reporting_tick_event_handler(sl_zigbee_af_event_t * event)
 {
   sl_zigbee_aps_frame_t *apsFrame = NULL;
   sl_zigbee_af_status_t status;
   sl_zigbee_af_attribute_type_t dataType;
-  uint16_t manufacturerCode = 0;
   uint8_t readData[READ_DATA_SIZE];
   uint16_t dataSize;
-  bool clientToServer = false;
   sl_zigbee_binding_table_entry_t bindingEntry;
   uint8_t reportSize = 0, currentPayloadMaxLength = 0, smallestPayloadMaxLength = 0;
-  uint16_t i;
+  uint32_t nowMs = halCommonGetInt32uMillisecondTick();
+  uint16_t i, j;
 
   for (i = 0; i < reportTableActiveLength; i++) {
     sl_zigbee_af_plugin_reporting_entry_t entry;
-    uint32_t elapsedMs;
     sli_zigbee_af_reporting_get_entry(i, &entry);
-    // We will only send reports for active reported attributes and only if a
-    // reportable change has occurred and the minimum interval has elapsed or
-    // if the maximum interval is set and has elapsed.
-    elapsedMs = elapsedTimeInt32u(sli_zigbee_af_report_volatile_data[i].lastReportTimeMs,
-                                  halCommonGetInt32uMillisecondTick());
-    if (!sl_zigbee_af_endpoint_is_enabled(entry.endpoint)
-        || entry.direction != SL_ZIGBEE_ZCL_REPORTING_DIRECTION_REPORTED
-        || (elapsedMs
-            < entry.data.reported.minInterval * MILLISECOND_TICKS_PER_SECOND)
-        || (!sli_zigbee_af_report_volatile_data[i].reportableChange
-            && (entry.data.reported.maxInterval == 0
-                || (elapsedMs
-                    < (entry.data.reported.maxInterval
-                       * MILLISECOND_TICKS_PER_SECOND))))) {
+    sli_zigbee_af_report_volatile_data[i].reportPending = reportIsDue(&entry, i, nowMs, 0);
+  }
+
+#if (SL_ZIGBEE_AF_PLUGIN_REPORTING_COALESCE_WINDOW_MS > 0)
+  pullForwardReports(nowMs);
+#endif
+
+  // Pending entries are grouped per command rather than taken in table order,
+  // so entries for the same cluster that are not adjacent in the table still
+  // share a Report Attributes command as long as it has room for them.
+  for (i = 0; i < reportTableActiveLength; i++) {
+    sl_zigbee_af_plugin_reporting_entry_t first;
+    if (!sli_zigbee_af_report_volatile_data[i].reportPending) {
       continue;
     }
-    status = readAttributeAndGetLastValue(&entry, i, &dataType, &dataSize, readData, READ_DATA_SIZE, false);
-    if (status != SL_ZIGBEE_ZCL_STATUS_SUCCESS) {
-      goto skipAttribute;
-    }
+    sli_zigbee_af_reporting_get_entry(i, &first);
 
-    reportSize = sizeof(entry.attributeId) + sizeof(dataType) + dataSize;
-
-    // If we have already started a report for a different attribute or
-    // destination, or if the current entry is too big for current report, send it and create a new one.
-    if (apsFrame != NULL
-        && (!(entry.endpoint == apsFrame->sourceEndpoint
-              && entry.clusterId == apsFrame->clusterId
-              && sl_zigbee_af_cluster_is_client(&entry) == clientToServer
-              && entry.manufacturerCode == manufacturerCode)
-            || (appResponseLength + reportSize > smallestPayloadMaxLength))) {
-      if (appResponseLength + reportSize > smallestPayloadMaxLength) {
+    for (j = i; j < reportTableActiveLength; j++) {
+      sl_zigbee_af_plugin_reporting_entry_t entry;
+      if (!sli_zigbee_af_report_volatile_data[j].reportPending) {
+        continue;
+      }
+      sli_zigbee_af_reporting_get_entry(j, &entry);
+      if (!reportsShareCommand(&first, &entry)) {
+        continue;
+      }
+      sli_zigbee_af_report_volatile_data[j].reportPending = false;
+
+      status = readAttributeAndGetLastValue(&entry, j, &dataType, &dataSize, readData, READ_DATA_SIZE, false);
+      if (status != SL_ZIGBEE_ZCL_STATUS_SUCCESS) {
+        goto skipAttribute;
+      }
+
+      reportSize = sizeof(entry.attributeId) + sizeof(dataType) + dataSize;
+
+      // If the current entry is too big for current report, send it and
+      // create a new one.
+      if (apsFrame != NULL
+          && appResponseLength + reportSize > smallestPayloadMaxLength) {
         sl_zigbee_af_reporting_println("Reporting Entry Full - creating new report");
+        conditionallySendReport(apsFrame->sourceEndpoint, apsFrame->clusterId);
+        apsFrame = NULL;
       }
-      conditionallySendReport(apsFrame->sourceEndpoint, apsFrame->clusterId);
-      apsFrame = NULL;
-    }
 
-    // If we haven't made the message header, make it.
-    if (apsFrame == NULL) {
-      apsFrame = sl_zigbee_af_get_command_aps_frame();
-      clientToServer = sl_zigbee_af_cluster_is_client(&entry);
-      // The manufacturer-specfic version of the fill API only creates a
-      // manufacturer-specfic command if the manufacturer code is set.  For
-      // non-manufacturer-specfic reports, the manufacturer code is unset, so
-      // we can get away with using this API for both cases.
-      sl_zigbee_af_fill_external_manufacturer_specific_buffer((clientToServer
-                                                               ? (ZCL_GLOBAL_COMMAND
-                                                                  | ZCL_FRAME_CONTROL_CLIENT_TO_SERVER
-                                                                  | SL_ZIGBEE_AF_DEFAULT_RESPONSE_POLICY_REQUESTS)
-                                                               : (ZCL_GLOBAL_COMMAND
-                                                                  | ZCL_FRAME_CONTROL_SERVER_TO_CLIENT
-                                                                  | SL_ZIGBEE_AF_DEFAULT_RESPONSE_POLICY_REQUESTS)),
-                                                              entry.clusterId,
-                                                              entry.manufacturerCode,
-                                                              ZCL_REPORT_ATTRIBUTES_COMMAND_ID,
-                                                              "");
-      apsFrame->sourceEndpoint = entry.endpoint;
-      apsFrame->options = SL_ZIGBEE_AF_DEFAULT_APS_OPTIONS;
-      manufacturerCode = entry.manufacturerCode;
-
-      // EMAPPFWKV2-1327: Reporting plugin does not account for reporting too many attributes
-      //                  in the same ZCL:ReportAttributes message
-
-      // find smallest maximum payload that the destination can receive for this cluster and source endpoint
-      uint8_t index;
-      smallestPayloadMaxLength = MAX_INT8U_VALUE;
-      for (index = 0; index < SL_ZIGBEE_BINDING_TABLE_SIZE; index++) {
-        status = (sl_zigbee_af_status_t)sl_zigbee_get_binding(index, &bindingEntry);
-        if (status == (sl_zigbee_af_status_t)SL_STATUS_OK && bindingEntry.local == entry.endpoint && bindingEntry.clusterId == entry.clusterId) {
-          currentPayloadMaxLength = sl_zigbee_af_maximum_aps_payload_length(bindingEntry.type, bindingEntry.networkIndex, apsFrame);
-          if (currentPayloadMaxLength < smallestPayloadMaxLength) {
-            smallestPayloadMaxLength = currentPayloadMaxLength;
+      // If we haven't made the message header, make it.
+      if (apsFrame == NULL) {
+        bool clientToServer = sl_zigbee_af_cluster_is_client(&entry);
+        apsFrame = sl_zigbee_af_get_command_aps_frame();
+        // The manufacturer-specfic version of the fill API only creates a
+        // manufacturer-specfic command if the manufacturer code is set.  For
+        // non-manufacturer-specfic reports, the manufacturer code is unset, so
+        // we can get away with using this API for both cases.
+        sl_zigbee_af_fill_external_manufacturer_specific_buffer((clientToServer
+                                                                 ? (ZCL_GLOBAL_COMMAND
+                                                                    | ZCL_FRAME_CONTROL_CLIENT_TO_SERVER
+                                                                    | SL_ZIGBEE_AF_DEFAULT_RESPONSE_POLICY_REQUESTS)
+                                                                 : (ZCL_GLOBAL_COMMAND
+                                                                    | ZCL_FRAME_CONTROL_SERVER_TO_CLIENT
+                                                                    | SL_ZIGBEE_AF_DEFAULT_RESPONSE_POLICY_REQUESTS)),
+                                                                entry.clusterId,
+                                                                entry.manufacturerCode,
+                                                                ZCL_REPORT_ATTRIBUTES_COMMAND_ID,
+                                                                "");
+        apsFrame->sourceEndpoint = entry.endpoint;
+        apsFrame->options = SL_ZIGBEE_AF_DEFAULT_APS_OPTIONS;
+
+        // EMAPPFWKV2-1327: Reporting plugin does not account for reporting too many attributes
+        //                  in the same ZCL:ReportAttributes message
+
+        // find smallest maximum payload that the destination can receive for this cluster and source endpoint
+        uint8_t index;
+        smallestPayloadMaxLength = MAX_INT8U_VALUE;
+        for (index = 0; index < SL_ZIGBEE_BINDING_TABLE_SIZE; index++) {
+          status = (sl_zigbee_af_status_t)sl_zigbee_get_binding(index, &bindingEntry);
+          if (status == (sl_zigbee_af_status_t)SL_STATUS_OK && bindingEntry.local == entry.endpoint && bindingEntry.clusterId == entry.clusterId) {
+            currentPayloadMaxLength = sl_zigbee_af_maximum_aps_payload_length(bindingEntry.type, bindingEntry.networkIndex, apsFrame);
+            if (currentPayloadMaxLength < smallestPayloadMaxLength) {
+              smallestPayloadMaxLength = currentPayloadMaxLength;
+            }
           }
         }
       }
-    }
 
-    // Payload is [attribute id:2] [type:1] [data:N].
-    (void) sl_zigbee_af_put_int16u_in_resp(entry.attributeId);
-    (void) sl_zigbee_af_put_int8u_in_resp(dataType);
+      // Payload is [attribute id:2] [type:1] [data:N].
+      (void) sl_zigbee_af_put_int16u_in_resp(entry.attributeId);
+      (void) sl_zigbee_af_put_int8u_in_resp(dataType);
 
 #if (BIGENDIAN_CPU)
-    if (isThisDataTypeSentLittleEndianOTA(dataType)) {
-      uint8_t i;
-      for (i = 0; i < dataSize; i++) {
-        (void) sl_zigbee_af_put_int8u_in_resp(readData[dataSize - i - 1]);
+      if (isThisDataTypeSentLittleEndianOTA(dataType)) {
+        uint8_t i;
+        for (i = 0; i < dataSize; i++) {
+          (void) sl_zigbee_af_put_int8u_in_resp(readData[dataSize - i - 1]);
+        }
+      } else {
+        sl_zigbee_af_put_block_in_resp(readData, dataSize);
       }
-    } else {
-      sl_zigbee_af_put_block_in_resp(readData, dataSize);
-    }
 #else
-    sl_zigbee_af_put_block_in_resp(readData, dataSize);
+      sl_zigbee_af_put_block_in_resp(readData, dataSize);
 #endif
+      sli_zigbee_af_reporting_stats.records++;
 
-    // Normally will arrive here at the conclusion of attribute processing.
-    // Update the state used to decide if an attribute value is ready to
-    // be reported. The shortest and longest intervals between reports for
-    // this attribute will be governed by the minInterval and maxInterval
-    // settings in the attribute's report configuration.
-    //
-    // Alternatively...
-    //
-    skipAttribute:
-    //
-    // ...may arrive here via goto label if attribute processing detected
-    // a condition that prevents the attribute value from being reported.
-    // In that case, this state still must be updated; otherwise the tick
-    // scheduler, executed at the end of this handler, will see the attribute
-    // as still being ready to be reported, and will schedule the handler
-    // to execute again IMMEDIATELY. If the problematic attribute condition
-    // persists, the handler will effectively try to execute continuously.
-    sli_zigbee_af_report_volatile_data[i].reportableChange = false;
-    sli_zigbee_af_report_volatile_data[i].lastReportTimeMs = halCommonGetInt32uMillisecondTick();
-  }
+      // Normally will arrive here at the conclusion of attribute processing.
+      // Update the state used to decide if an attribute value is ready to
+      // be reported. The shortest and longest intervals between reports for
+      // this attribute will be governed by the minInterval and maxInterval
+      // settings in the attribute's report configuration.
+      //
+      // Alternatively...
+      //
+      skipAttribute:
+      //
+      // ...may arrive here via goto label if attribute processing detected
+      // a condition that prevents the attribute value from being reported.
+      // In that case, this state still must be updated; otherwise the tick
+      // scheduler, executed at the end of this handler, will see the attribute
+      // as still being ready to be reported, and will schedule the handler
+      // to execute again IMMEDIATELY. If the problematic attribute condition
+      // persists, the handler will effectively try to execute continuously.
+      sli_zigbee_af_report_volatile_data[j].reportableChange = false;
+      sli_zigbee_af_report_volatile_data[j].lastReportTimeMs = halCommonGetInt32uMillisecondTick();
+    }
 
-  if (apsFrame != NULL) {
-    conditionallySendReport(apsFrame->sourceEndpoint, apsFrame->clusterId);
+    if (apsFrame != NULL) {
+      conditionallySendReport(apsFrame->sourceEndpoint, apsFrame->clusterId);
+      apsFrame = NULL;
+    }
   }
   scheduleTick();
 }
@@ -365,6 +443,7 @@ static void conditionallySendReport(uint8_t endpoint, sl_zigbee_af_cluster_id_t
       // stops all reports if the device is a s2s device
       && ((sl_zigbee_af_network_state() != SL_ZIGBEE_JOINED_NETWORK_S2S_INITIATOR)
           && (sl_zigbee_af_network_state() != SL_ZIGBEE_JOINED_NETWORK_S2S_TARGET))) {
+    sli_zigbee_af_reporting_stats.frames++;
     status = sl_zigbee_af_send_command_unicast_to_bindings_with_cb((sl_zigbee_af_message_sent_function_t)(&retrySendReport));
 
     // If the callback table is full, attempt to send the message with no
@@ -99,10 +99,19 @@ typedef struct {
   uint32_t lastReportTimeMs;
   sl_zigbee_af_difference_type_t lastReportValue;
   bool reportableChange;
+  bool reportPending;
 } sli_zigbee_af_report_volatile_data_type;
 
 extern sli_zigbee_af_report_volatile_data_type sli_zigbee_af_report_volatile_data[];
 
+typedef struct {
+  uint32_t frames;          // Report Attributes commands sent
+  uint32_t records;         // Attribute records carried by those commands
+  uint32_t pulledForward;   // Records sent early to share a command
+} sli_zigbee_af_reporting_stats_type;
+
+extern sli_zigbee_af_reporting_stats_type sli_zigbee_af_reporting_stats;
+
 /**
  * @name API
  * @{
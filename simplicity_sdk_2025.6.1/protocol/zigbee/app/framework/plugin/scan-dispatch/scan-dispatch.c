@@ -28,67 +28,261 @@ static void scanNetworkEventHandler(sl_zigbee_af_event_t * event);
 // -----------------------------------------------------------------------------
 // Internal implementation elements
 
-static uint8_t head = 0;
-static uint8_t tail = 0;
+// Upper bits of a channel mask select the channel page.
+#define SCAN_DISPATCH_PAGE_MASK    0xF8000000UL
+#define SCAN_DISPATCH_CHANNEL_BITS 27
+
+typedef struct {
+  sl_zigbee_af_plugin_scan_dispatch_scan_data_t data;
+  uint8_t priority;
+  // Whether the radio scan in progress was started for this entry.
+  bool inScan;
+} sli_zigbee_af_scan_dispatch_queue_entry_t;
+
+// The queue is kept sorted by priority, FIFO within a priority.
 static uint8_t count = 0;
-static sl_zigbee_af_plugin_scan_dispatch_scan_data_t handlerQueue[SL_ZIGBEE_AF_PLUGIN_SCAN_DISPATCH_SCAN_QUEUE_SIZE];
+static sli_zigbee_af_scan_dispatch_queue_entry_t handlerQueue[SL_ZIGBEE_AF_PLUGIN_SCAN_DISPATCH_SCAN_QUEUE_SIZE];
 #define handlerQueueIsEmpty() (!count)
 #define handlerQueueIsFull()  (count == SL_ZIGBEE_AF_PLUGIN_SCAN_DISPATCH_SCAN_QUEUE_SIZE)
 
-// We save 12 bytes of text by having this as a function.
-static uint8_t handlerQueueNextIndex(uint8_t i)
+static bool scanActive = false;
+static uint32_t scanChannelMask = 0;
+
+#if (SL_ZIGBEE_AF_PLUGIN_SCAN_DISPATCH_BEACON_CACHE_SIZE > 0)
+typedef struct {
+  sl_zigbee_zigbee_network_t network;
+  uint8_t lqi;
+  int8_t rssi;
+} sli_zigbee_af_scan_dispatch_cached_beacon_t;
+
+static sli_zigbee_af_scan_dispatch_cached_beacon_t beaconCache[SL_ZIGBEE_AF_PLUGIN_SCAN_DISPATCH_BEACON_CACHE_SIZE];
+static uint8_t beaconCacheCount = 0;
+// Channels whose beacons are all in the cache, and when they were scanned.
+static uint32_t beaconCacheChannelMask = 0;
+static uint32_t beaconCacheTimeMs[SCAN_DISPATCH_CHANNEL_BITS];
+// Channels of the scan in progress that cannot be cached.
+static uint32_t beaconCacheIncompleteMask = 0;
+
+static bool beaconCacheApplies(const sl_zigbee_af_plugin_scan_dispatch_scan_data_t *data)
+{
+  return (data->scanType == SL_ZIGBEE_ACTIVE_SCAN
+          && (data->channelMask & SCAN_DISPATCH_PAGE_MASK) == 0);
+}
+
+static void beaconCacheDropChannels(uint32_t channelMask)
+{
+  uint8_t i = 0;
+
+  while (i < beaconCacheCount) {
+    if (channelMask & BIT32(beaconCache[i].network.channel)) {
+      beaconCache[i] = beaconCache[--beaconCacheCount];
+    } else {
+      i++;
+    }
+  }
+  beaconCacheChannelMask &= ~channelMask;
+}
+
+static void beaconCacheAdd(const sl_zigbee_zigbee_network_t *network,
+                           uint8_t lqi,
+                           int8_t rssi)
+{
+  uint8_t i;
+
+  // Keep one entry per network and channel, with the latest link quality.
+  for (i = 0; i < beaconCacheCount; i++) {
+    if (beaconCache[i].network.channel == network->channel
+        && beaconCache[i].network.panId == network->panId
+        && memcmp(beaconCache[i].network.extendedPanId,
+                  network->extendedPanId,
+                  EXTENDED_PAN_ID_SIZE) == 0) {
+      break;
+    }
+  }
+
+  if (i == beaconCacheCount) {
+    if (beaconCacheCount == SL_ZIGBEE_AF_PLUGIN_SCAN_DISPATCH_BEACON_CACHE_SIZE) {
+      beaconCacheIncompleteMask |= BIT32(network->channel);
+      return;
+    }
+    beaconCacheCount++;
+  }
+
+  beaconCache[i].network = *network;
+  beaconCache[i].lqi = lqi;
+  beaconCache[i].rssi = rssi;
+}
+
+static bool beaconCacheIsFresh(uint32_t channelMask)
+{
+  uint32_t nowMs = halCommonGetInt32uMillisecondTick();
+  uint8_t channel;
+
+  if ((channelMask & ~beaconCacheChannelMask) != 0) {
+    return false;
+  }
+
+  for (channel = 0; channel < SCAN_DISPATCH_CHANNEL_BITS; channel++) {
+    if ((channelMask & BIT32(channel))
+        && (elapsedTimeInt32u(beaconCacheTimeMs[channel], nowMs)
+            >= SL_ZIGBEE_AF_PLUGIN_SCAN_DISPATCH_BEACON_CACHE_TIMEOUT_MS)) {
+      return false;
+    }
+  }
+
+  return true;
+}
+#endif // SL_ZIGBEE_AF_PLUGIN_SCAN_DISPATCH_BEACON_CACHE_SIZE > 0
+
+static void handlerQueueRemove(uint8_t index)
+{
+  count--;
+  memmove(&handlerQueue[index],
+          &handlerQueue[index + 1],
+          (count - index) * sizeof(handlerQueue[0]));
+}
+
+static void addTarget(sl_zigbee_af_plugin_scan_dispatch_scan_results_handler_t *targets,
+                      uint8_t *targetCount,
+                      sl_zigbee_af_plugin_scan_dispatch_scan_results_handler_t handler)
 {
-  return (++i % SL_ZIGBEE_AF_PLUGIN_SCAN_DISPATCH_SCAN_QUEUE_SIZE);
+  uint8_t i;
+
+  // A handler queued more than once gets each result only once.
+  for (i = 0; i < *targetCount; i++) {
+    if (targets[i] == handler) {
+      return;
+    }
+  }
+  targets[(*targetCount)++] = handler;
 }
 
+// Delivers results to the handlers of the scan in progress. Results for a
+// specific channel only go to handlers that asked for that channel.
 static void maybeCallNextHandler(uint8_t statusOrRssi,
                                  uint8_t channelOrLqi,
                                  sl_zigbee_network_scan_type_t scanType,
                                  bool isComplete,
                                  bool isFailure,
-                                 sl_zigbee_zigbee_network_t *network)
+                                 sl_zigbee_zigbee_network_t *network,
+                                 uint8_t channel)
 {
-  if (!handlerQueueIsEmpty()) {
-    sl_zigbee_af_plugin_scan_dispatch_scan_results_t results = {
-      .status = statusOrRssi,
-      .rssi = statusOrRssi,
-      .channel = channelOrLqi,
-      .lqi = channelOrLqi,
-      .network = network,
-      .mask = (scanType
-               | (isComplete
-                  ? EM_AF_PLUGIN_SCAN_DISPATCH_SCAN_RESULTS_MASK_COMPLETE
-                  : 0)
-               | (isFailure
-                  ? EM_AF_PLUGIN_SCAN_DISPATCH_SCAN_RESULTS_MASK_FAILURE
-                  : 0)),
-    };
-    handlerQueue[head].handler(&results);
+  sl_zigbee_af_plugin_scan_dispatch_scan_results_handler_t targets[SL_ZIGBEE_AF_PLUGIN_SCAN_DISPATCH_SCAN_QUEUE_SIZE];
+  uint8_t targetCount = 0;
+  bool anyInScan = false;
+  uint8_t i;
+
+  if (handlerQueueIsEmpty()) {
+    return;
+  }
+
+  for (i = 0; i < count; i++) {
+    if (handlerQueue[i].inScan) {
+      anyInScan = true;
+      if (isFailure
+          || (handlerQueue[i].data.channelMask & ~SCAN_DISPATCH_PAGE_MASK & BIT32(channel))) {
+        addTarget(targets, &targetCount, handlerQueue[i].data.handler);
+      }
+    }
+  }
+
+  // Results of a scan this plugin did not start go to the head of the queue.
+  if (!anyInScan) {
+    addTarget(targets, &targetCount, handlerQueue[0].data.handler);
+  }
+
+  sl_zigbee_af_plugin_scan_dispatch_scan_results_t results = {
+    .status = statusOrRssi,
+    .rssi = statusOrRssi,
+    .channel = channelOrLqi,
+    .lqi = channelOrLqi,
+    .network = network,
+    .mask = (scanType
+             | (isComplete
+                ? EM_AF_PLUGIN_SCAN_DISPATCH_SCAN_RESULTS_MASK_COMPLETE
+                : 0)
+             | (isFailure
+                ? EM_AF_PLUGIN_SCAN_DISPATCH_SCAN_RESULTS_MASK_FAILURE
+                : 0)),
+  };
+
+  for (i = 0; i < targetCount; i++) {
+    targets[i](&results);
+  }
+}
+
+// Removes the handlers of the scan in progress, or the head of the queue if
+// the scan was not started by this plugin.
+static void dequeueScanHandlers(void)
+{
+  bool anyInScan = false;
+  uint8_t i = 0;
+
+  while (i < count) {
+    if (handlerQueue[i].inScan) {
+      anyInScan = true;
+      handlerQueueRemove(i);
+    } else {
+      i++;
+    }
   }
+
+  if (!anyInScan && !handlerQueueIsEmpty()) {
+    handlerQueueRemove(0);
+  }
+  scanActive = false;
 }
 
 // -----------------------------------------------------------------------------
 // Public API
 
-sl_status_t sl_zigbee_af_scan_dispatch_schedule_scan(sl_zigbee_af_plugin_scan_dispatch_scan_data_t *data)
+sl_status_t sl_zigbee_af_scan_dispatch_schedule_scan_with_priority(sl_zigbee_af_plugin_scan_dispatch_scan_data_t *data,
+                                                                   uint8_t priority)
 {
-  sl_status_t status = SL_STATUS_FAIL;
+  uint8_t index;
 
-  if (!handlerQueueIsFull()) {
-    handlerQueue[tail] = *data;
-    tail = handlerQueueNextIndex(tail);
-    count++;
-    status = SL_STATUS_OK;
-    sl_zigbee_af_event_set_active(scanNetworkEvents);
+  if (handlerQueueIsFull()) {
+    return SL_STATUS_FAIL;
   }
 
-  return status;
+  // Go ahead of lower priority entries. Requests merged into the scan in
+  // progress can sit anywhere in the queue and are stepped over, but the
+  // head of the queue, which started that scan, keeps its place.
+  index = count;
+  while (index > 0) {
+    if (handlerQueue[index - 1].inScan) {
+      if (index == 1) {
+        break;
+      }
+    } else if (handlerQueue[index - 1].priority >= priority) {
+      break;
+    }
+    index--;
+  }
+
+  memmove(&handlerQueue[index + 1],
+          &handlerQueue[index],
+          (count - index) * sizeof(handlerQueue[0]));
+  handlerQueue[index].data = *data;
+  handlerQueue[index].priority = priority;
+  handlerQueue[index].inScan = false;
+  count++;
+  sl_zigbee_af_event_set_active(scanNetworkEvents);
+
+  return SL_STATUS_OK;
+}
+
+sl_status_t sl_zigbee_af_scan_dispatch_schedule_scan(sl_zigbee_af_plugin_scan_dispatch_scan_data_t *data)
+{
+  return sl_zigbee_af_scan_dispatch_schedule_scan_with_priority(data,
+                                                                SL_ZIGBEE_AF_PLUGIN_SCAN_DISPATCH_PRIORITY_NORMAL);
 }
 
 void sl_zigbee_af_scan_dispatch_clear(void)
 {
   sl_zigbee_stop_scan();
-  head = tail = count = 0;
+  count = 0;
+  scanActive = false;
 }
 
 // -----------------------------------------------------------------------------
@@ -102,30 +296,110 @@ void sli_zigbee_af_scan_dispatch_init_callback(uint8_t init_level)
                                   scanNetworkEventHandler);
 }
 
+#if (SL_ZIGBEE_AF_PLUGIN_SCAN_DISPATCH_BEACON_CACHE_SIZE > 0)
+// Answers the request at the head of the queue from the beacon cache.
+static void serveFromBeaconCache(void)
+{
+  sl_zigbee_af_plugin_scan_dispatch_scan_data_t data = handlerQueue[0].data;
+  uint32_t channelMask = data.channelMask;
+  uint8_t firstChannel = 0;
+  uint8_t i;
+
+  handlerQueueRemove(0);
+
+  for (i = 0; i < beaconCacheCount; i++) {
+    if (channelMask & BIT32(beaconCache[i].network.channel)) {
+      sl_zigbee_zigbee_network_t network = beaconCache[i].network;
+      sl_zigbee_af_plugin_scan_dispatch_scan_results_t results = {
+        .rssi = beaconCache[i].rssi,
+        .lqi = beaconCache[i].lqi,
+        .network = &network,
+        .mask = SL_ZIGBEE_ACTIVE_SCAN,
+      };
+      data.handler(&results);
+    }
+  }
+
+  while (firstChannel < SCAN_DISPATCH_CHANNEL_BITS
+         && !(channelMask & BIT32(firstChannel))) {
+    firstChannel++;
+  }
+
+  sl_zigbee_af_plugin_scan_dispatch_scan_results_t results = {
+    .status = SL_STATUS_OK,
+    .channel = firstChannel,
+    .mask = (SL_ZIGBEE_ACTIVE_SCAN
+             | EM_AF_PLUGIN_SCAN_DISPATCH_SCAN_RESULTS_MASK_COMPLETE),
+  };
+  data.handler(&results);
+}
+#endif // SL_ZIGBEE_AF_PLUGIN_SCAN_DISPATCH_BEACON_CACHE_SIZE > 0
+
 static void scanNetworkEventHandler(sl_zigbee_af_event_t * event)
 {
   sl_status_t status;
+  uint8_t i;
 
   sl_zigbee_af_event_set_inactive(scanNetworkEvents);
 
   // If there is a handler in the queue, start a scan for it.
   // If we are already scanning, we should try again.
   // If there is an error, we abort the scan and tell the consumer.
-  if (!handlerQueueIsEmpty()) {
-    status = sl_zigbee_start_scan(handlerQueue[head].scanType,
-                                  handlerQueue[head].channelMask,
-                                  handlerQueue[head].duration);
+  if (!handlerQueueIsEmpty() && !scanActive) {
+#if (SL_ZIGBEE_AF_PLUGIN_SCAN_DISPATCH_BEACON_CACHE_SIZE > 0)
+    if (beaconCacheApplies(&handlerQueue[0].data)
+        && beaconCacheIsFresh(handlerQueue[0].data.channelMask)) {
+      serveFromBeaconCache();
+      sl_zigbee_af_event_set_active(scanNetworkEvents);
+      return;
+    }
+#endif
+
+    // Compatible requests further down the queue share the radio scan.
+    scanChannelMask = handlerQueue[0].data.channelMask;
+    handlerQueue[0].inScan = true;
+#if (SL_ZIGBEE_AF_PLUGIN_SCAN_DISPATCH_MERGE_REQUESTS == 1)
+    for (i = 1; i < count; i++) {
+      if (handlerQueue[i].data.scanType == handlerQueue[0].data.scanType
+          && handlerQueue[i].data.duration == handlerQueue[0].data.duration
+          && ((handlerQueue[i].data.channelMask ^ scanChannelMask)
+              & SCAN_DISPATCH_PAGE_MASK) == 0) {
+        scanChannelMask |= handlerQueue[i].data.channelMask;
+        handlerQueue[i].inScan = true;
+      }
+    }
+#else
+    (void)i;
+#endif
 
-    if (status != SL_STATUS_MAC_SCANNING) {
-      if (status != SL_STATUS_OK) {
+    status = sl_zigbee_start_scan(handlerQueue[0].data.scanType,
+                                  scanChannelMask,
+                                  handlerQueue[0].data.duration);
+
+    if (status == SL_STATUS_OK) {
+      scanActive = true;
+#if (SL_ZIGBEE_AF_PLUGIN_SCAN_DISPATCH_BEACON_CACHE_SIZE > 0)
+      if (beaconCacheApplies(&handlerQueue[0].data)) {
+        beaconCacheDropChannels(scanChannelMask);
+        beaconCacheIncompleteMask = 0;
+      }
+#endif
+    } else {
+      for (i = 0; i < count; i++) {
+        handlerQueue[i].inScan = false;
+      }
+      if (status != SL_STATUS_MAC_SCANNING) {
+        // Only the head of the queue is told; compatible requests get
+        // their own attempt.
+        handlerQueue[0].inScan = true;
         maybeCallNextHandler(status,
                              0,     // channel. 0 indicating that the actual scan was not started
-                             handlerQueue[head].scanType,
+                             handlerQueue[0].data.scanType,
                              true,     // complete?
                              true,     // failure?
-                             NULL);     // network
-        head = handlerQueueNextIndex(head);
-        count--;
+                             NULL,     // network
+                             0);
+        dequeueScanHandlers();
         sl_zigbee_af_event_set_active(scanNetworkEvents);
       }
     }
@@ -139,38 +413,98 @@ void sli_zigbee_af_scan_dispatch_energy_scan_result_callback(uint8_t channel, in
                        SL_ZIGBEE_ENERGY_SCAN,
                        false,     // complete?
                        false,     // failure?
-                       NULL);     // network
+                       NULL,      // network
+                       channel);
 }
 
 void sli_zigbee_af_scan_dispatch_network_found_callback(sl_zigbee_zigbee_network_t *networkFound,
                                                         uint8_t lqi,
                                                         int8_t rssi)
 {
+#if (SL_ZIGBEE_AF_PLUGIN_SCAN_DISPATCH_BEACON_CACHE_SIZE > 0)
+  if (scanActive
+      && !handlerQueueIsEmpty()
+      && beaconCacheApplies(&handlerQueue[0].data)) {
+    beaconCacheAdd(networkFound, lqi, rssi);
+  }
+#endif
+
   maybeCallNextHandler((uint8_t)rssi,
                        lqi,
                        SL_ZIGBEE_ACTIVE_SCAN,
                        false,     // complete?
                        false,     // failure?
-                       networkFound);
+                       networkFound,
+                       networkFound->channel);
 }
 
 void sli_zigbee_af_scan_dispatch_scan_complete_callback(uint8_t channel, sl_status_t status)
 {
-  maybeCallNextHandler(status,
-                       channel,
-                       handlerQueue[head].scanType,
-                       true,     // complete?
-                       false,     // failure?
-                       NULL);     // network
+  if (handlerQueueIsEmpty()) {
+    return;
+  }
+
+#if (SL_ZIGBEE_AF_PLUGIN_SCAN_DISPATCH_BEACON_CACHE_SIZE > 0)
+  if (scanActive && beaconCacheApplies(&handlerQueue[0].data)) {
+    if (status != SL_STATUS_OK) {
+      beaconCacheIncompleteMask |= BIT32(channel);
+    } else {
+      uint32_t nowMs = halCommonGetInt32uMillisecondTick();
+      uint32_t cachedMask = scanChannelMask & ~beaconCacheIncompleteMask;
+      uint8_t i;
+
+      beaconCacheDropChannels(beaconCacheIncompleteMask);
+      for (i = 0; i < SCAN_DISPATCH_CHANNEL_BITS; i++) {
+        if (cachedMask & BIT32(i)) {
+          beaconCacheTimeMs[i] = nowMs;
+        }
+      }
+      beaconCacheChannelMask |= cachedMask;
+    }
+  }
+#endif
 
   // The scan is done when the status is set to SL_STATUS_OK.
   // See documentation for the sl_zigbee_scan_complete_handler callback.
   // For Active scan we call the EMBER_ACTIVE_SCAN_XX anyways,
   // beacuse of the change in network-steering code which
   // continues to schedule a scan on the next channel after a failure
-  if ((status == SL_STATUS_OK) && !handlerQueueIsEmpty()) {
-    head = handlerQueueNextIndex(head);
-    count--;
+  if (status == SL_STATUS_OK) {
+    sl_zigbee_af_plugin_scan_dispatch_scan_results_handler_t targets[SL_ZIGBEE_AF_PLUGIN_SCAN_DISPATCH_SCAN_QUEUE_SIZE];
+    sl_zigbee_network_scan_type_t scanType = handlerQueue[0].data.scanType;
+    uint8_t targetCount = 0;
+    bool anyInScan = false;
+    uint8_t i;
+
+    for (i = 0; i < count; i++) {
+      if (handlerQueue[i].inScan) {
+        anyInScan = true;
+        addTarget(targets, &targetCount, handlerQueue[i].data.handler);
+      }
+    }
+    if (!anyInScan) {
+      addTarget(targets, &targetCount, handlerQueue[0].data.handler);
+    }
+
+    dequeueScanHandlers();
     sl_zigbee_af_event_set_active(scanNetworkEvents);
+
+    sl_zigbee_af_plugin_scan_dispatch_scan_results_t results = {
+      .status = status,
+      .channel = channel,
+      .mask = (scanType
+               | EM_AF_PLUGIN_SCAN_DISPATCH_SCAN_RESULTS_MASK_COMPLETE),
+    };
+    for (i = 0; i < targetCount; i++) {
+      targets[i](&results);
+    }
+  } else {
+    maybeCallNextHandler(status,
+                         channel,
+                         handlerQueue[0].data.scanType,
+                         true,     // complete?
+                         false,     // failure?
+                         NULL,     // network
+                         channel);
   }
 }
@@ -51,6 +51,41 @@
   #define SL_ZIGBEE_AF_PLUGIN_SCAN_DISPATCH_SCAN_QUEUE_SIZE 10
 #endif
 
+/**
+ * @brief Whether pending requests of the same scan type and duration are
+ * served by a single radio scan over the union of their channel masks.
+ */
+#ifndef SL_ZIGBEE_AF_PLUGIN_SCAN_DISPATCH_MERGE_REQUESTS
+  #define SL_ZIGBEE_AF_PLUGIN_SCAN_DISPATCH_MERGE_REQUESTS 0
+#endif
+
+/**
+ * @brief The number of active scan results kept to answer repeated
+ * requests without scanning. 0 disables the beacon cache.
+ */
+#ifndef SL_ZIGBEE_AF_PLUGIN_SCAN_DISPATCH_BEACON_CACHE_SIZE
+  #define SL_ZIGBEE_AF_PLUGIN_SCAN_DISPATCH_BEACON_CACHE_SIZE 0
+#endif
+
+/**
+ * @brief How long, in milliseconds, cached results of a channel are used.
+ */
+#ifndef SL_ZIGBEE_AF_PLUGIN_SCAN_DISPATCH_BEACON_CACHE_TIMEOUT_MS
+  #define SL_ZIGBEE_AF_PLUGIN_SCAN_DISPATCH_BEACON_CACHE_TIMEOUT_MS 5000
+#endif
+
+/**
+ * @name Scan Priorities
+ * @{
+ */
+/** @brief Priority of background scans. */
+#define SL_ZIGBEE_AF_PLUGIN_SCAN_DISPATCH_PRIORITY_LOW    0
+/** @brief Priority used by ::sl_zigbee_af_scan_dispatch_schedule_scan. */
+#define SL_ZIGBEE_AF_PLUGIN_SCAN_DISPATCH_PRIORITY_NORMAL 1
+/** @brief Priority of time-critical scans. */
+#define SL_ZIGBEE_AF_PLUGIN_SCAN_DISPATCH_PRIORITY_HIGH   2
+/** @} */
+
 /**
  * @brief The information regarding scan results.
  */
@@ -200,6 +235,30 @@ sl_zigbee_af_scan_dispatch_scan_results_are_failure(sl_zigbee_af_plugin_scan_dis
  */
 sl_status_t sl_zigbee_af_scan_dispatch_schedule_scan(sl_zigbee_af_plugin_scan_dispatch_scan_data_t *data);
 
+/** @brief Schedule a scan with a priority.
+ *
+ * Same as ::sl_zigbee_af_scan_dispatch_schedule_scan, except that the scan is
+ * queued ahead of pending scans with a lower priority. Scans of equal
+ * priority are served in the order they were scheduled. A scan in progress
+ * is never preempted.
+ *
+ * If ::SL_ZIGBEE_AF_PLUGIN_SCAN_DISPATCH_MERGE_REQUESTS is enabled, pending
+ * scans compatible with the one at the head of the queue are performed in
+ * the same radio scan. Each handler only receives the results for the
+ * channels it asked for.
+ *
+ * @param data An ::sl_zigbee_af_plugin_scan_dispatch_scan_data_t that holds the scanType,
+ * channelMask, duration, and ::sl_zigbee_af_plugin_scan_dispatch_scan_results_handler_t for
+ * the scan.
+ * @param priority One of the SL_ZIGBEE_AF_PLUGIN_SCAN_DISPATCH_PRIORITY_ values.
+ * Higher values are served first.
+ *
+ * @return An ::sl_status_t value describing the result of the scheduling of
+ * a scan.
+ */
+sl_status_t sl_zigbee_af_scan_dispatch_schedule_scan_with_priority(sl_zigbee_af_plugin_scan_dispatch_scan_data_t *data,
+                                                                   uint8_t priority);
+
 /** @brief Remove all consumers in the queue.
  *
  * A call to this function will remove all consumers in the queue for scan
@@ -53,6 +53,10 @@
   #include "test-harness-config.h"
 #endif
 
+#ifdef SL_CATALOG_ZIGBEE_COUNTERS_PRESENT
+  #include "counters-metrics.h"
+#endif
+
 #ifdef EZSP_HOST
 #define INVALID_MESSAGE_TAG 0xFFFF
 #define setStackProfile(stackProfile) \
@@ -303,6 +307,10 @@ void sli_zigbee_af_message_sent_handler(sl_status_t status,
   callback = getMessageSentCallback(messageTag);
   invalidateMessageSentCallbackEntry(messageTag);
 
+#ifdef COUNTERS_METRICS_ENABLED
+  sli_zigbee_af_counters_metrics_message_sent(messageTag, status);
+#endif
+
   if (status == SL_STATUS_OK
       && apsFrame->profileId == SL_ZIGBEE_ZDO_PROFILE_ID
       && apsFrame->clusterId < CLUSTER_ID_RESPONSE_MINIMUM) {
@@ -1308,6 +1316,12 @@ static sl_status_t send(sl_zigbee_outgoing_message_type_t type,
     messageSentCallbacks[messageSentIndex].callback = callback;
   }
 
+#ifdef COUNTERS_METRICS_ENABLED
+  if (status == SL_STATUS_OK && messageTag != INVALID_MESSAGE_TAG) {
+    sli_zigbee_af_counters_metrics_message_queued(messageTag, type, apsFrame);
+  }
+#endif
+
   if (status == SL_STATUS_IN_PROGRESS
       && apsFrame->options & SL_ZIGBEE_APS_OPTION_DSA_SIGN) {
     // We consider "in progress" signed messages as being sent successfully.
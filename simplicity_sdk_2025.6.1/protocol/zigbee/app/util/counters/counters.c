@@ -27,6 +27,14 @@
 
 #include "counters.h"
 
+#ifdef SL_COMPONENT_CATALOG_PRESENT
+#include "sl_component_catalog.h"
+#endif
+
+#ifdef SL_CATALOG_ZIGBEE_COUNTERS_PRESENT
+#include "app/framework/plugin/counters/counters-metrics.h"
+#endif
+
 uint16_t sli_zigbee_counters[SL_ZIGBEE_COUNTER_TYPE_COUNT];
 uint16_t sli_zigbee_counters_thresholds[SL_ZIGBEE_COUNTER_TYPE_COUNT];
 #if !defined(SL_ZIGBEE_MULTI_NETWORK_STRIPPED)
@@ -137,6 +145,10 @@ void sli_zigbee_stack_populate_counters(sl_zigbee_counter_type_t type, sl_zigbee
   multiNetworkCounterHandler(type, data);
 #endif // SL_ZIGBEE_MULTI_NETWORK_STRIPPED
 
+#ifdef COUNTERS_METRICS_ENABLED
+  sli_zigbee_af_counters_metrics_event(type, data);
+#endif // COUNTERS_METRICS_ENABLED
+
   if (destionationRequiredCounter
       && destinationNodeId == SL_ZIGBEE_NULL_NODE_ID) {
     //this might be an error
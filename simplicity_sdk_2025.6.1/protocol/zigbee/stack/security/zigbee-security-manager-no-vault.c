@@ -32,6 +32,7 @@
 #ifdef SL_COMPONENT_CATALOG_PRESENT
 #include "sl_component_catalog.h"
 #endif
+#include "sl_zigbee_security_manager_config.h"
 #include "stack/security/zigbee-security-manager-internal.h"
 
 // Externs
@@ -77,17 +78,72 @@ static uint8_t zb_sec_man_internal_key[SL_ZIGBEE_ENCRYPTION_KEY_SIZE];
 //needs to load an internal key.
 static uint8_t zb_sec_man_context_key_backup[SL_ZIGBEE_ENCRYPTION_KEY_SIZE];
 
-//MIC length to be used by AES-CCM.  Changing this to a value besides 4
-//requires calling sli_zigbee_stack_sec_man_aes_ccm_extended directly (calling the
-//regular sl_zigbee_sec_man_aes_ccm sets it back to 4).
-static uint8_t stored_mic_length = 4;
-
 // Eventually pull this from aps-keys-full.h
 #define KEY_TABLE_ENTRY_HAS_PSA_ID          (BIT(6))
 
 // This bit indicates if entry in the key table is a Symmetric Passphrase
 #define KEY_TABLE_SYMMETRIC_PASSPHRASE      (BIT(7))
 
+//Derived keys remembered by sli_zigbee_stack_sec_man_load_key_context.
+//Deriving a key runs two AES-MMO hashes, so frames protected with a derived
+//key (key-transport, key-load, hashed TC link keys) would otherwise redo the
+//derivation every time the context is loaded.
+#if SL_ZIGBEE_SEC_MAN_DERIVED_KEY_CACHE_SIZE > 0
+//An entry is only used when the source key, derivation and EUI64 all match, so
+//a key changed behind the security manager's back can never hit a stale entry.
+//Such an entry is wiped as soon as the lookup sees its source key changed.
+typedef struct {
+  bool valid;
+  sl_zigbee_sec_man_derived_key_type_t derived_type;
+  sl_802154_long_addr_t eui64;
+  sl_zigbee_sec_man_key_t source_key;
+  sl_zigbee_sec_man_key_t derived_key;
+} zb_sec_man_derived_key_cache_entry_t;
+
+static zb_sec_man_derived_key_cache_entry_t zb_sec_man_derived_key_cache[SL_ZIGBEE_SEC_MAN_DERIVED_KEY_CACHE_SIZE];
+static uint8_t zb_sec_man_derived_key_cache_next;
+
+//Wipe cached key material whenever a key is stored or deleted.
+static void zb_sec_man_flush_derived_key_cache(void)
+{
+  memset(zb_sec_man_derived_key_cache, 0, sizeof(zb_sec_man_derived_key_cache));
+  zb_sec_man_derived_key_cache_next = 0;
+}
+
+static zb_sec_man_derived_key_cache_entry_t *zb_sec_man_find_derived_key(const sl_zigbee_sec_man_key_t* source_key,
+                                                                         const sl_zigbee_sec_man_context_t* context)
+{
+  for (uint8_t i = 0; i < SL_ZIGBEE_SEC_MAN_DERIVED_KEY_CACHE_SIZE; i++) {
+    zb_sec_man_derived_key_cache_entry_t *entry = &zb_sec_man_derived_key_cache[i];
+    if (entry->valid
+        && entry->derived_type == context->derived_type
+        && memcmp(entry->eui64, context->eui64, EUI64_SIZE) == 0) {
+      if (memcmp(&entry->source_key, source_key, sizeof(entry->source_key)) == 0) {
+        return entry;
+      }
+      memset(entry, 0, sizeof(*entry));
+    }
+  }
+  return NULL;
+}
+
+static void zb_sec_man_add_derived_key(const sl_zigbee_sec_man_key_t* source_key,
+                                       const sl_zigbee_sec_man_context_t* context,
+                                       const sl_zigbee_sec_man_key_t* derived_key)
+{
+  zb_sec_man_derived_key_cache_entry_t *entry = &zb_sec_man_derived_key_cache[zb_sec_man_derived_key_cache_next];
+
+  entry->valid = true;
+  entry->derived_type = context->derived_type;
+  memmove(entry->eui64, context->eui64, EUI64_SIZE);
+  memmove(&entry->source_key, source_key, sizeof(entry->source_key));
+  memmove(&entry->derived_key, derived_key, sizeof(entry->derived_key));
+  zb_sec_man_derived_key_cache_next = (zb_sec_man_derived_key_cache_next + 1) % SL_ZIGBEE_SEC_MAN_DERIVED_KEY_CACHE_SIZE;
+}
+#else
+#define zb_sec_man_flush_derived_key_cache()
+#endif // SL_ZIGBEE_SEC_MAN_DERIVED_KEY_CACHE_SIZE > 0
+
 void sli_zigbee_stack_sec_man_init_context(sl_zigbee_sec_man_context_t* context)
 {
   memset(context, 0, sizeof(*context));
@@ -107,6 +163,7 @@ void sli_zigbee_stack_sec_man_set_context_extended_ccm_alg(sl_zigbee_sec_man_con
 sl_status_t zb_sec_man_store_nwk_key(sl_zigbee_sec_man_context_t* context,
                                      const sl_zigbee_sec_man_key_t* plaintext_key)
 {
+  zb_sec_man_flush_derived_key_cache();
   tokTypeStackKeys tok;
   if (context->key_index == 1) {
     sli_zigbee_stack_token_primitive(true, &tok, COMMON_TOKEN_STACK_ALTERNATE_KEY, sizeof(tokTypeStackKeys));
@@ -137,6 +194,7 @@ sl_status_t zb_sec_man_fetch_nwk_key(sl_zigbee_sec_man_context_t* context,
 sl_status_t zb_sec_man_store_tc_link_key(sl_zigbee_sec_man_context_t* context,
                                          const sl_zigbee_sec_man_key_t* plaintext_key)
 {
+  zb_sec_man_flush_derived_key_cache();
   tokTypeStackTrustCenter tok;
   sli_zigbee_stack_token_primitive(true, &tok, COMMON_TOKEN_STACK_TRUST_CENTER, sizeof(tokTypeStackTrustCenter));
   memmove(tok.key, plaintext_key->key, sizeof(plaintext_key->key));
@@ -168,6 +226,7 @@ sl_status_t zb_sec_man_fetch_tc_link_key(sl_zigbee_sec_man_context_t* context,
 sl_status_t zb_sec_man_store_transient_key(sl_zigbee_sec_man_context_t* context,
                                            const sl_zigbee_sec_man_key_t* plaintext_key)
 {
+  zb_sec_man_flush_derived_key_cache();
   sl_status_t status;
   sl_zigbee_key_struct_t keyStruct;
 
@@ -260,6 +319,7 @@ sl_status_t zb_sec_man_fetch_zll_key(sl_zigbee_sec_man_context_t* context,
 sl_status_t zb_sec_man_store_zll_key(sl_zigbee_sec_man_context_t* context,
                                      const sl_zigbee_sec_man_key_t* plaintext_key)
 {
+  zb_sec_man_flush_derived_key_cache();
   tokTypeStackZllSecurity zllSecurityToken;
   (void)sl_token_manager_get_data(COMMON_TOKEN_STACK_ZLL_SECURITY, (void *)&zllSecurityToken, sizeof(tokTypeStackZllSecurity));
 
@@ -300,6 +360,7 @@ sl_status_t zb_sec_man_fetch_gp_key(sl_zigbee_sec_man_context_t* context,
 sl_status_t zb_sec_man_store_gp_key(sl_zigbee_sec_man_context_t* context,
                                     const sl_zigbee_sec_man_key_t* plaintext_key)
 {
+  zb_sec_man_flush_derived_key_cache();
   uint8_t index = context->key_index;
   if (context->core_key_type == SL_ZB_SEC_MAN_KEY_TYPE_GREEN_POWER_PROXY_TABLE_KEY) {
     tokTypeStackGpProxyTableEntry tok;
@@ -319,6 +380,7 @@ sl_status_t zb_sec_man_store_gp_key(sl_zigbee_sec_man_context_t* context,
 sl_status_t zb_sec_man_store_in_link_key_table(sl_zigbee_sec_man_context_t* context,
                                                const sl_zigbee_sec_man_key_t* plaintext_key)
 {
+  zb_sec_man_flush_derived_key_cache();
   sl_zigbee_key_struct_t keyStruct;
   memset(&keyStruct, 0, sizeof(sl_zigbee_key_struct_t));
   memmove(keyStruct.partnerEUI64, context->eui64, EUI64_SIZE);
@@ -403,6 +465,7 @@ sl_status_t zb_sec_man_fetch_from_link_key_table(sl_zigbee_sec_man_context_t* co
 
 sl_status_t sli_zigbee_stack_sec_man_delete_transient_key(sl_zigbee_sec_man_context_t* context)
 {
+  zb_sec_man_flush_derived_key_cache();
   sl_zigbee_transient_key_data_t transientKeyData = { 0 };
 
   if (context->flags & ZB_SEC_MAN_FLAG_UNCONFIRMED_TRANSIENT_KEY) {
@@ -427,6 +490,7 @@ sl_status_t sli_zigbee_stack_sec_man_delete_transient_key(sl_zigbee_sec_man_cont
 
 sl_status_t sli_zigbee_stack_sec_man_delete_key_table_key(sl_zigbee_sec_man_context_t* context)
 {
+  zb_sec_man_flush_derived_key_cache();
   sl_status_t status = SL_STATUS_FAIL;
 
   if (context->flags & ZB_SEC_MAN_FLAG_EUI_IS_VALID) {
@@ -500,7 +564,6 @@ sl_status_t sli_zigbee_stack_sec_man_aes_ccm_extended(uint8_t* nonce,
                                                       uint8_t mic_length,
                                                       uint8_t* output)
 {
-  stored_mic_length = mic_length;
   //Ported over from the PSA implementations inside ccm-star.c
   psa_status_t psa_status;
   size_t tag_len;
@@ -518,20 +581,20 @@ sl_status_t sli_zigbee_stack_sec_man_aes_ccm_extended(uint8_t* nonce,
   if (encrypt) {
     psa_status = AEAD_ENCRYPT_TAG_FCT(
       &attr, zb_sec_man_context_key, sizeof(zb_sec_man_context_key),
-      PSA_ALG_AEAD_WITH_SHORTENED_TAG(PSA_ALG_CCM, stored_mic_length),
+      PSA_ALG_AEAD_WITH_SHORTENED_TAG(PSA_ALG_CCM, mic_length),
       nonce, NONCE_LENGTH,
       input, encryption_start_index,
       input + encryption_start_index, length - encryption_start_index,
       output + encryption_start_index, length - encryption_start_index, &output_length,
-      output + length, stored_mic_length, &tag_len);
+      output + length, mic_length, &tag_len);
   } else {
     psa_status = AEAD_DECRYPT_TAG_FCT(
       &attr, zb_sec_man_context_key, sizeof(zb_sec_man_context_key),
-      PSA_ALG_AEAD_WITH_SHORTENED_TAG(PSA_ALG_CCM, stored_mic_length),
+      PSA_ALG_AEAD_WITH_SHORTENED_TAG(PSA_ALG_CCM, mic_length),
       nonce, NONCE_LENGTH,
       input, encryption_start_index,
       input + encryption_start_index, length - encryption_start_index,
-      input + length, stored_mic_length,
+      input + length, mic_length,
       output + encryption_start_index, length - encryption_start_index, &output_length);
   }
 
@@ -542,7 +605,7 @@ sl_status_t sli_zigbee_stack_sec_man_aes_ccm_extended(uint8_t* nonce,
   }
 
   if (psa_status != PSA_SUCCESS || output_length != (uint8_t) (length - encryption_start_index)
-      || (encrypt && tag_len != stored_mic_length)) {
+      || (encrypt && tag_len != mic_length)) {
     return SL_STATUS_INVALID_PARAMETER;
   } else {
     return SL_STATUS_OK;
@@ -595,13 +658,7 @@ sl_status_t sli_zigbee_stack_sec_man_aes_128_crypt_block(bool encrypt,
 #define STANDALONE_VARIABLE_FIELD_INDEX_HIGH    14
 #define STANDALONE_VARIABLE_FIELD_INDEX_LOW     15
 
-#ifndef TEMP_BUFFER_SIZE
-#define TEMP_BUFFER_SIZE 256
-#endif
-
-static uint8_t encryptionBlock[ENCRYPTION_BLOCK_SIZE];
-
-static void encryptNonce(uint8_t *nonce,
+static void encryptNonce(const uint8_t *nonce,
                          uint8_t flagsMask,
                          uint16_t variableField,
                          uint8_t block[ENCRYPTION_BLOCK_SIZE])
@@ -624,20 +681,41 @@ static uint16_t min(uint16_t num1,
   return num2;
 }
 
+//XOR count bytes of src into dst, 32 bits at a time where possible. The
+//memcpy calls compile to plain word loads/stores and keep this safe for
+//unaligned frame buffers.
+static void xorBytes(uint8_t *dst,
+                     const uint8_t *src,
+                     uint16_t count)
+{
+  uint32_t a;
+  uint32_t b;
+
+  for (; count >= sizeof(uint32_t); count -= sizeof(uint32_t)) {
+    memcpy(&a, dst, sizeof(a));
+    memcpy(&b, src, sizeof(b));
+    a ^= b;
+    memcpy(dst, &a, sizeof(a));
+    dst += sizeof(uint32_t);
+    src += sizeof(uint32_t);
+  }
+  while (count-- > 0) {
+    *dst++ ^= *src++;
+  }
+}
+
 static uint8_t xorBytesIntoBlock(uint8_t *block,
                                  uint8_t blockIndex,
                                  const uint8_t *bytes,
                                  uint16_t count)
 {
-  for (uint16_t i = 0; i < count; ) {
-    uint16_t needed = ENCRYPTION_BLOCK_SIZE - blockIndex;
-    uint16_t todo = count - i;
-    uint16_t copied = min(todo, needed);
+  while (count > 0) {
+    uint16_t copied = min(count, ENCRYPTION_BLOCK_SIZE - blockIndex);
 
-    for (uint16_t j = 0; j < copied; j++, blockIndex++) {
-      block[blockIndex] ^= *bytes++;
-    }
-    i += copied;
+    xorBytes(block + blockIndex, bytes, copied);
+    blockIndex += copied;
+    bytes += copied;
+    count -= copied;
 
     if (blockIndex == ENCRYPTION_BLOCK_SIZE) {
       sli_util_stand_alone_encrypt_block(block);
@@ -650,40 +728,45 @@ static uint8_t xorBytesIntoBlock(uint8_t *block,
 static void ccmEncryptData(uint8_t *bytes,
                            uint16_t length,
                            uint8_t blockCount,
-                           uint8_t *nonce)
+                           const uint8_t *nonce)
 {
+  uint8_t keyStream[ENCRYPTION_BLOCK_SIZE];
+
   while (length > 0) {
     uint8_t todo = (uint8_t)min(length, ENCRYPTION_BLOCK_SIZE);
-    encryptNonce(nonce, 0x01, blockCount, encryptionBlock);
+    encryptNonce(nonce, 0x01, blockCount, keyStream);
     blockCount += 1;
 
-    for (uint8_t i = 0; i < todo; i++) {
-      *bytes++ ^= encryptionBlock[i];
-    }
-
+    xorBytes(bytes, keyStream, todo);
+    bytes += todo;
     length -= todo;
   }
 }
 
-static sl_status_t zb_sec_man_calc_encrypt_mic(uint8_t* nonce,
-                                               uint8_t* data,
+//Computes the encrypted MIC over the auth data and the plaintext payload
+//in data, and writes mic_length bytes of it to mic.
+static sl_status_t zb_sec_man_calc_encrypt_mic(const uint8_t* nonce,
+                                               const uint8_t* data,
                                                uint8_t encryption_start_index,
-                                               uint8_t length)
+                                               uint8_t length,
+                                               uint8_t mic_length,
+                                               uint8_t* mic)
 {
+  uint8_t block[ENCRYPTION_BLOCK_SIZE];
   uint8_t blockIndex = 2;     // skip over frame length field
   const uint8_t *chunk = data;
   uint16_t chunklen;
 
   chunklen = encryption_start_index;
-  encryptNonce(nonce, 0x49, length - encryption_start_index, encryptionBlock);
+  encryptNonce(nonce, 0x49, length - encryption_start_index, block);
   // first two bytes are the 16-bit representation of the frame length,
   // high byte first
-  encryptionBlock[0] ^= HIGH_BYTE(encryption_start_index);
-  encryptionBlock[1] ^= LOW_BYTE(encryption_start_index);
+  block[0] ^= HIGH_BYTE(encryption_start_index);
+  block[1] ^= LOW_BYTE(encryption_start_index);
   // phase 0: go over authenticated data
   // phase 1: go over the payload
   for (uint8_t phase = 0; phase < 2; phase++) {
-    blockIndex = xorBytesIntoBlock(encryptionBlock,
+    blockIndex = xorBytesIntoBlock(block,
                                    blockIndex,
                                    chunk,
                                    chunklen);
@@ -692,14 +775,14 @@ static sl_status_t zb_sec_man_calc_encrypt_mic(uint8_t* nonce,
 
     // finish off authData if not on an encryption block boundary
     if (blockIndex > 0) {
-      sli_util_stand_alone_encrypt_block(encryptionBlock);
+      sli_util_stand_alone_encrypt_block(block);
       blockIndex = 0;
     }
   }
 
-  memcpy(data + length, encryptionBlock, stored_mic_length);
+  memcpy(mic, block, mic_length);
   // The MIC gets encrypted as block zero of the message.
-  ccmEncryptData(data + length, stored_mic_length, 0, nonce);
+  ccmEncryptData(mic, mic_length, 0, nonce);
   return SL_STATUS_OK;
 }
 
@@ -715,22 +798,23 @@ sl_status_t sli_zigbee_stack_sec_man_aes_ccm_extended(uint8_t* nonce,
                                                       uint8_t mic_length,
                                                       uint8_t* output)
 {
-  stored_mic_length = mic_length;
+  if (mic_length > ENCRYPTION_BLOCK_SIZE) {
+    return SL_STATUS_INVALID_PARAMETER;
+  }
   //Move input into output location for in-place encryption
-  memcpy(output, input, length);
-  bool authenticated;
+  memmove(output, input, length);
   if (encrypt) {
-    zb_sec_man_calc_encrypt_mic(nonce, output, encryption_start_index, length);
+    zb_sec_man_calc_encrypt_mic(nonce, output, encryption_start_index, length, mic_length, output + length);
     if (length > encryption_start_index) {
       ccmEncryptData(output + encryption_start_index, length - encryption_start_index, 1, nonce);
     }
   } else {
+    //The MIC is computed into its own block, so the received MIC at
+    //input + length stays intact even when decrypting in place.
+    uint8_t mic[ENCRYPTION_BLOCK_SIZE];
     ccmEncryptData(output + encryption_start_index, length - encryption_start_index, 1, nonce);
-    uint8_t temp[TEMP_BUFFER_SIZE];
-    memcpy(temp, output, length);
-    zb_sec_man_calc_encrypt_mic(nonce, temp, encryption_start_index, length);
-    authenticated = memcmp(input + length, temp + length, stored_mic_length) == 0;
-    if (!authenticated) {
+    zb_sec_man_calc_encrypt_mic(nonce, output, encryption_start_index, length, mic_length, mic);
+    if (memcmp(input + length, mic, mic_length) != 0) {
       //MIC check failed
       return SL_STATUS_INVALID_SIGNATURE;
     }
@@ -869,7 +953,16 @@ sl_status_t sli_zigbee_stack_sec_man_load_key_context(sl_zigbee_sec_man_context_
   sli_zigbee_stack_sec_man_export_key(context, &plaintext_key);
   if (context->derived_type != SL_ZB_SEC_MAN_DERIVED_KEY_TYPE_NONE) {
     sl_zigbee_sec_man_key_t derived_key;
+#if SL_ZIGBEE_SEC_MAN_DERIVED_KEY_CACHE_SIZE > 0
+    zb_sec_man_derived_key_cache_entry_t *entry = zb_sec_man_find_derived_key(&plaintext_key, context);
+    if (entry != NULL) {
+      memcpy(&derived_key, &entry->derived_key, SL_ZIGBEE_ENCRYPTION_KEY_SIZE);
+    } else if (zb_sec_man_derive_key(&plaintext_key, context, &derived_key) == SL_STATUS_OK) {
+      zb_sec_man_add_derived_key(&plaintext_key, context, &derived_key);
+    }
+#else
     zb_sec_man_derive_key(&plaintext_key, context, &derived_key);
+#endif
     memcpy(&zb_sec_man_context_key, &derived_key, SL_ZIGBEE_ENCRYPTION_KEY_SIZE);
   } else {
     memcpy(&zb_sec_man_context_key, &plaintext_key, SL_ZIGBEE_ENCRYPTION_KEY_SIZE);
@@ -897,6 +990,7 @@ sl_status_t zb_sec_man_delete_key_by_psa_id(UNUSED uint32_t psa_id)
 sl_status_t zb_sec_man_store_internal_key(sl_zigbee_sec_man_context_t* context,
                                           const sl_zigbee_sec_man_key_t* plaintext_key)
 {
+  zb_sec_man_flush_derived_key_cache();
   memmove(&zb_sec_man_internal_key, plaintext_key, SL_ZIGBEE_ENCRYPTION_KEY_SIZE);
   return SL_STATUS_OK;
 }
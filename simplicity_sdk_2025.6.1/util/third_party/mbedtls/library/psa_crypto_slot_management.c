@@ -192,6 +192,23 @@ typedef struct {
 
 static psa_global_data_t global_data;
 
+#if defined(SL_PSA_KEY_SLOT_ID_INDEX_SIZE) && (SL_PSA_KEY_SLOT_ID_INDEX_SIZE > 0)
+/* Direct-mapped index from persistent key identifier to the cache slot that
+ * was last found holding it, stored as slot index + 1 (0 means no entry).
+ *
+ * Entries are hints: a lookup checks that the slot is full and holds the
+ * requested key before using it, and falls back to scanning the cache
+ * otherwise. Slots that get wiped or reused therefore never need to update
+ * the index. It is only accessed with the global key slot mutex held.
+ */
+MBEDTLS_STATIC_ASSERT(PERSISTENT_KEY_CACHE_COUNT < 0xFFFF,
+                      "Key slot index entries are too small for the cache");
+static uint16_t key_slot_id_index[SL_PSA_KEY_SLOT_ID_INDEX_SIZE];
+
+#define KEY_SLOT_ID_INDEX_OF(key_id) \
+    ((size_t) (key_id) % SL_PSA_KEY_SLOT_ID_INDEX_SIZE)
+#endif /* SL_PSA_KEY_SLOT_ID_INDEX_SIZE */
+
 static uint8_t psa_get_key_slots_initialized(void)
 {
     uint8_t initialized;
@@ -346,6 +363,44 @@ int psa_is_valid_key_id(mbedtls_svc_key_id_t key, int vendor_ok)
     return 0;
 }
 
+/** Find the cache slot holding a loaded persistent key.
+ *
+ * \param key           Key identifier to query.
+ *
+ * \return The full key slot holding \p key, or NULL if the key is not loaded.
+ */
+static psa_key_slot_t *find_persistent_key_slot(mbedtls_svc_key_id_t key)
+{
+    size_t slot_idx;
+    psa_key_slot_t *slot;
+#if defined(SL_PSA_KEY_SLOT_ID_INDEX_SIZE) && (SL_PSA_KEY_SLOT_ID_INDEX_SIZE > 0)
+    size_t index_idx = KEY_SLOT_ID_INDEX_OF(MBEDTLS_SVC_KEY_ID_GET_KEY_ID(key));
+
+    slot_idx = key_slot_id_index[index_idx];
+    if (slot_idx != 0) {
+        slot = get_persistent_key_slot(slot_idx - 1);
+        if ((slot->state == PSA_SLOT_FULL) &&
+            (mbedtls_svc_key_id_equal(key, slot->attr.id))) {
+            return slot;
+        }
+    }
+#endif /* SL_PSA_KEY_SLOT_ID_INDEX_SIZE */
+
+    for (slot_idx = 0; slot_idx < PERSISTENT_KEY_CACHE_COUNT; slot_idx++) {
+        slot = get_persistent_key_slot(slot_idx);
+        /* Only consider slots which are in a full state. */
+        if ((slot->state == PSA_SLOT_FULL) &&
+            (mbedtls_svc_key_id_equal(key, slot->attr.id))) {
+#if defined(SL_PSA_KEY_SLOT_ID_INDEX_SIZE) && (SL_PSA_KEY_SLOT_ID_INDEX_SIZE > 0)
+            key_slot_id_index[index_idx] = (uint16_t) (slot_idx + 1);
+#endif /* SL_PSA_KEY_SLOT_ID_INDEX_SIZE */
+            return slot;
+        }
+    }
+
+    return NULL;
+}
+
 /** Get the description in memory of a key given its identifier and lock it.
  *
  * The descriptions of volatile keys and loaded persistent keys are
@@ -385,7 +440,6 @@ static psa_status_t psa_get_and_lock_key_slot_in_memory(
 {
     psa_status_t status = PSA_ERROR_CORRUPTION_DETECTED;
     psa_key_id_t key_id = MBEDTLS_SVC_KEY_ID_GET_KEY_ID(key);
-    size_t slot_idx;
     psa_key_slot_t *slot = NULL;
 
     if (psa_key_id_is_volatile(key_id)) {
@@ -405,16 +459,8 @@ static psa_status_t psa_get_and_lock_key_slot_in_memory(
             return PSA_ERROR_INVALID_HANDLE;
         }
 
-        for (slot_idx = 0; slot_idx < PERSISTENT_KEY_CACHE_COUNT; slot_idx++) {
-            slot = get_persistent_key_slot(slot_idx);
-            /* Only consider slots which are in a full state. */
-            if ((slot->state == PSA_SLOT_FULL) &&
-                (mbedtls_svc_key_id_equal(key, slot->attr.id))) {
-                break;
-            }
-        }
-        status = (slot_idx < MBEDTLS_PSA_KEY_SLOT_COUNT) ?
-                 PSA_SUCCESS : PSA_ERROR_DOES_NOT_EXIST;
+        slot = find_persistent_key_slot(key);
+        status = (slot != NULL) ? PSA_SUCCESS : PSA_ERROR_DOES_NOT_EXIST;
     }
 
     if (status == PSA_SUCCESS) {